@@ -0,0 +1,482 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+// 8aot reads an 8ball core file ("8BALL MEM DUMP VERSION=1", as
+// written by save_state()) and translates the code reachable from the
+// saved PC into C. Each basic block becomes one function that works
+// on the machine registers in pdp8.h. Link the output with the
+// emulator built with -DAOT_BUILD (see the 8ball-aot target in the
+// Makefile) and run it with --engine=aot.
+//
+// Blocks are formed like in the block engine: they end at JMP, JMS,
+// ISZ, group two OPR and page boundaries, and stop before IOTs and EAE
+// instructions which are left to the interpreter. A block checks on
+// entry that its words are unmodified and that no breakpoint is set
+// inside it, otherwise the interpreter runs instead.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cpu.h"
+
+static short image[MEMSIZE];
+static char is_block[MEMSIZE];   // address starts a translated block
+static char queued[MEMSIZE];
+static short worklist[MEMSIZE];
+static int worklist_len = 0;
+
+#define NEXT(x) (((x) & FIELD_MASK) | INC_12BIT(x))
+#define IS_MRI(w) (((w) & IF_MASK) <= JMP)
+#define IS_INTERPRETED(w) (((w) & IF_MASK) == IOT || \
+                           (((w) & (IF_MASK|OPR_G2|OPR_G3)) == (OPR|OPR_G2|OPR_G3) && \
+                            ((w) & (SCA|EAE_OP_MASK))))
+#define IS_CIF(w) (((w) & IF_MASK) == IOT && (((w) & DEV_MASK) >> 3) >= 020 \
+                   && (((w) & DEV_MASK) >> 3) <= 027 && ((w) & CIF))
+
+static int read_core(char *filename, short *start_pc)
+{
+  FILE *core = fopen(filename, "r");
+
+  if( NULL == core ){
+    perror("Unable to open core file");
+    return 0;
+  }
+
+  int version = -1;
+  if( fscanf(core, "8BALL MEM DUMP VERSION=%d\n", &version) != 1 || version != 1 ){
+    printf("Unable to parse version string\n");
+    return 0;
+  }
+
+  unsigned int rpc, rac, rmq, rdf, rsr;
+  if( fscanf(core, "CPU STATE:\nPC = %o AC = %o MQ = %o DF = %o SR = %o\n",
+             &rpc, &rac, &rmq, &rdf, &rsr) != 5 ){
+    printf("Unable to parse register set 1\n");
+    return 0;
+  }
+  *start_pc = rpc & 077777;
+
+  unsigned int rion, rion_delay, rrtf_delay, rintr;
+  if( fscanf(core, "ION = %o ION_DELAY = %o RTF_DELAY = %o INTR = %o\nMEMORY:\n",
+             &rion, &rion_delay, &rrtf_delay, &rintr) != 4 ){
+    printf("Unable to parse register set 2\n");
+    return 0;
+  }
+
+  int i = 0, field_no, page_no;
+  for(int f=0;f < 8;f++){
+    if( fscanf(core, "FIELD %o\n", &field_no) != 1 || field_no != f ){
+      printf("Unable to find FIELD %.2o\n", f);
+      return 0;
+    }
+    for(int p=0;p < 32;p++){
+      if( fscanf(core, "PAGE %o\n", &page_no) != 1 || page_no != p ){
+        printf("Unable to find PAGE %.3o\n", p);
+        return 0;
+      }
+      for(int w=0;w < 128;w++){
+        unsigned int word;
+        if( fscanf(core, "%o ", &word) != 1 ){
+          printf("Unable to find all memory\n");
+          return 0;
+        }
+        image[i++] = word & B12_MASK;
+      }
+    }
+  }
+
+  fclose(core);
+  return 1;
+}
+
+
+static void add_root(short addr)
+{
+  addr &= 077777;
+  if( ! queued[addr] ){
+    queued[addr] = 1;
+    worklist[worklist_len++] = addr;
+  }
+}
+
+
+static short direct(short addr)
+{
+  short word = image[addr];
+  short da = (word & Z_MASK) ? (addr & (FIELD_MASK|PAGE_MASK)) : (addr & FIELD_MASK);
+  return da | (word & WORD_MASK);
+}
+
+
+// Same as cpu_instruction_time(), MRIs, OPRs and IOTs only.
+static short instruction_time(short addr)
+{
+  short word = image[addr];
+  short t = T_FAST_CYCLE;
+
+  if( IS_MRI(word) ){
+    if( (word & IF_MASK) != JMP ){
+      t += T_SLOW_CYCLE;
+    }
+    if( word & I_MASK ){
+      t += T_FAST_CYCLE;
+      if( (direct(addr) & B12_MASK) >= 010 && (direct(addr) & B12_MASK) <= 017 ){
+        t += T_AUTOINDEX;
+      }
+    }
+  }
+  return t;
+}
+
+
+static char ends_block(short word)
+{
+  switch( word & IF_MASK ){
+  case ISZ:
+  case JMS:
+  case JMP:
+    return 1;
+  case OPR:
+    return (word & OPR_G2) && ! (word & OPR_G3);
+  default:
+    return 0;
+  }
+}
+
+
+// Returns the address of the last instruction in the block starting
+// at start, or -1 if start is interpreted.
+static short block_last(short start)
+{
+  short addr = start;
+
+  if( IS_INTERPRETED(image[addr]) ){
+    return -1;
+  }
+
+  while( 1 ){
+    short next = NEXT(addr);
+    if( ends_block(image[addr]) || (addr & WORD_MASK) == WORD_MASK ||
+        IS_INTERPRETED(image[next]) ){
+      return addr;
+    }
+    addr = next;
+  }
+}
+
+
+// Add the possible targets of a JMP or JMS at addr. A CIF right before
+// changes the field of the target.
+static void add_jump_targets(short addr, short offset)
+{
+  short word = image[addr];
+  short target = direct(addr);
+  short prev = (addr & FIELD_MASK) | ((addr - 1) & B12_MASK);
+
+  if( word & I_MASK ){
+    target = (target & FIELD_MASK) | image[target];
+  }
+  add_root((target & FIELD_MASK) | ((target + offset) & B12_MASK));
+  if( IS_CIF(image[prev]) ){
+    short field = (image[prev] & MMU_DI_MASK) << 9;
+    add_root(field | ((target + offset) & B12_MASK));
+  }
+}
+
+
+static void find_blocks(short start_pc)
+{
+  add_root(start_pc);
+  add_root(1); // Interrupt handler
+
+  while( worklist_len > 0 ){
+    short start = worklist[--worklist_len];
+    short last = block_last(start);
+
+    if( last < 0 ){
+      // IOT or EAE, interpreted. Execution continues after it or
+      // skips.
+      add_root(NEXT(start));
+      add_root(NEXT(NEXT(start)));
+      continue;
+    }
+
+    is_block[start] = 1;
+
+    short word = image[last];
+    switch( word & IF_MASK ){
+    case JMP:
+      add_jump_targets(last, 0);
+      break;
+    case JMS:
+      add_jump_targets(last, 1);
+      add_root(NEXT(last));
+      break;
+    case ISZ:
+    case OPR:
+      add_root(NEXT(last));
+      add_root(NEXT(NEXT(last)));
+      break;
+    default:
+      add_root(NEXT(last));
+      break;
+    }
+  }
+}
+
+
+// Writes the micro operations of an OPR as straight line code.
+static void emit_opr(FILE *out, short addr, short word)
+{
+  if( ! (word & OPR_G2) ){
+    if( word & CLA ) fprintf(out, "  a &= LINK_MASK;\n");
+    if( word & CLL ) fprintf(out, "  a &= AC_MASK;\n");
+    if( word & CMA ) fprintf(out, "  a ^= AC_MASK;\n");
+    if( word & CML ) fprintf(out, "  a ^= LINK_MASK;\n");
+    if( word & IAC ) fprintf(out, "  a = (a + 1) & LINK_AC_MASK;\n");
+    for( int i = 0; i < ((word & BSW) ? 2 : 1); i++ ){
+      if( word & RAR ) fprintf(out, "  a = (a >> 1) | ((a & 1) << 12);\n");
+    }
+    for( int i = 0; i < ((word & BSW) ? 2 : 1); i++ ){
+      if( word & RAL ) fprintf(out, "  a = ((a << 1) & LINK_AC_MASK) | (a >> 12);\n");
+    }
+    if( (word & (RAR|RAL|BSW)) == BSW ){
+      fprintf(out, "  a = (a & LINK_MASK) | ((a & 07700) >> 6) | ((a & 00077) << 6);\n");
+    }
+  } else if( ! (word & OPR_G3) ){
+    fprintf(out, "  cond = 0");
+    if( word & SMA ) fprintf(out, " || (a & SIGN_BIT_MASK)");
+    if( word & SZA ) fprintf(out, " || ! (a & AC_MASK)");
+    if( word & SNL ) fprintf(out, " || (a & LINK_MASK)");
+    fprintf(out, ";\n");
+    if( word & CLA ) fprintf(out, "  a &= LINK_MASK;\n");
+    fprintf(out, "  m->pc = %scond ? 0%.5o : 0%.5o;\n",
+            (word & OPR_AND) ? "! " : "", NEXT(NEXT(addr)), NEXT(addr));
+    if( word & (OSR|HLT) ){
+      fprintf(out, "  if( m->uf ){\n    m->intr |= UINTR_FLAG;\n  } else {\n");
+      if( word & OSR ) fprintf(out, "    a |= m->sr;\n");
+      if( word & HLT ) fprintf(out, "    res = -1;\n");
+      fprintf(out, "  }\n");
+    }
+  } else {
+    if( word & CLA ) fprintf(out, "  a &= LINK_MASK;\n");
+    if( (word & MQA) && (word & MQL) ){
+      fprintf(out, "  {\n    short tmp = q & B12_MASK;\n    q = a & AC_MASK;\n    a = (a & LINK_MASK) | tmp;\n  }\n");
+    } else {
+      if( word & MQA ) fprintf(out, "  a |= (q & B12_MASK);\n");
+      if( word & MQL ) fprintf(out, "  q = a & AC_MASK;\n  a &= LINK_MASK;\n");
+    }
+  }
+}
+
+
+// Leave the block after the instruction at index n-1 if a store to
+// cpma hit the block itself. time is the emulated time of the first n
+// instructions.
+static void emit_modified_check(FILE *out, short start, short last, short next, int n,
+                                long time)
+{
+  fprintf(out, "  if( cpma >= 0%.5o && cpma <= 0%.5o ){\n", start, last);
+  fprintf(out, "    m->ac = a; m->mq = q; m->pc = 0%.5o; *count = %d;\n", next, n);
+  fprintf(out, "    m->time += %ld;\n    return 0;\n  }\n", time);
+}
+
+
+static void emit_block(FILE *out, short start)
+{
+  short last = block_last(start);
+  short addr;
+  long time = 0;
+  int n;
+
+  fprintf(out, "static int b%.5o(pdp8_machine_t *m, int *count)\n{\n", start);
+  char has_mri = 0, has_skip = 0;
+  long lead_time = 0; // Time of all but the last instruction
+  for( addr = start, n = 1; ; addr = NEXT(addr), n++ ){
+    has_mri |= IS_MRI(image[addr]);
+    has_skip |= (image[addr] & IF_MASK) == OPR && (image[addr] & OPR_G2) &&
+      ! (image[addr] & OPR_G3);
+    if( addr == last ){
+      break;
+    }
+    lead_time += instruction_time(addr);
+  }
+
+  fprintf(out, "  short a = m->ac, q = m->mq;\n");
+  if( has_mri ) fprintf(out, "  short cpma;\n");
+  if( has_skip ) fprintf(out, "  char cond;\n");
+  fprintf(out, "  int res = 0;\n\n");
+
+  fprintf(out, "  if( m->mem[0%.5o] != 0%.4o", start, image[start]);
+  for( addr = NEXT(start); addr != NEXT(last); addr = NEXT(addr) ){
+    fprintf(out, " ||\n      m->mem[0%.5o] != 0%.4o || m->breakpoints[0%.5o]", addr, image[addr], addr);
+  }
+  fprintf(out, " ){\n    *count = 0;\n    return 0;\n  }\n");
+  // Like the block engine, stop at the budget and when an event is due.
+  // A block that doesn't fit is left to cpu_process().
+  fprintf(out, "  if( *count < %d || m->time + %ld >= m->deadline ){\n"
+          "    *count = 0;\n    return 0;\n  }\n", n, lead_time);
+
+  for( addr = start, n = 1; ; addr = NEXT(addr), n++ ){
+    short word = image[addr];
+    short next = NEXT(addr);
+
+    fprintf(out, "\n  // %.5o  %.4o\n", addr, word);
+    fprintf(out, "  CPU_COUNT(m, 0%.5o, 0%.4o);\n", addr, word);
+    fprintf(out, "  COVERAGE_SET(m, 0%.5o);\n", addr);
+    fprintf(out, "  HISTORY_ADD(m, 0%.5o, 0%.4o, a, q);\n", addr, word);
+    time += instruction_time(addr);
+
+    if( IS_MRI(word) ){
+      short da = direct(addr);
+      if( word & I_MASK ){
+        if( (da & B12_MASK) >= 010 && (da & B12_MASK) <= 017 ){
+          fprintf(out, "  cpu_store_mem(m, 0%.5o, INC_12BIT(m->mem[0%.5o]));\n", da, da);
+          if( da >= start && da <= last ){
+            fprintf(out, "  cpma = 0%.5o;\n", da);
+            emit_modified_check(out, start, last, next, n, time);
+          }
+        }
+        if( (word & IF_MASK) < JMS ){
+          fprintf(out, "  cpma = m->df_base | (m->mem[0%.5o] & B12_MASK);\n", da);
+        } else {
+          fprintf(out, "  cpma = 0%.5o | (m->mem[0%.5o] & B12_MASK);\n", da & FIELD_MASK, da);
+        }
+      } else {
+        fprintf(out, "  cpma = 0%.5o;\n", da);
+      }
+    }
+
+    switch( word & IF_MASK ){
+    case AND:
+      fprintf(out, "  a &= (m->mem[cpma] | LINK_MASK);\n");
+      break;
+    case TAD:
+      fprintf(out, "  a = (a + m->mem[cpma]) & LINK_AC_MASK;\n");
+      break;
+    case ISZ:
+      fprintf(out, "  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));\n");
+      fprintf(out, "  m->pc = m->mem[cpma] == 0 ? 0%.5o : 0%.5o;\n", NEXT(next), next);
+      break;
+    case DCA:
+      fprintf(out, "  cpu_store_mem(m, cpma, a & AC_MASK);\n  a &= LINK_MASK;\n");
+      if( addr != last ){
+        emit_modified_check(out, start, last, next, n, time);
+      }
+      break;
+    case JMS:
+      fprintf(out, "  m->pc = 0%.5o;\n", next);
+      fprintf(out, "  if( m->intr_inhibit ){\n"
+              "    m->if_base = m->ib << 12;\n"
+              "    cpma = m->if_base | (cpma & B12_MASK);\n"
+              "    m->uf = m->ub;\n"
+              "    m->intr_inhibit = 0;\n"
+              "  }\n");
+      fprintf(out, "  cpu_store_mem(m, cpma, m->pc & B12_MASK);\n");
+      fprintf(out, "  m->pc = m->if_base | INC_12BIT(cpma);\n");
+      break;
+    case JMP:
+      fprintf(out, "  if( m->intr_inhibit ){\n"
+              "    m->if_base = m->ib << 12;\n"
+              "    cpma = m->if_base | (cpma & B12_MASK);\n"
+              "    m->uf = m->ub;\n"
+              "    m->intr_inhibit = 0;\n"
+              "  }\n");
+      fprintf(out, "  m->pc = cpma;\n");
+      break;
+    case OPR:
+      emit_opr(out, addr, word);
+      if( addr == last && ! ends_block(word) ){
+        fprintf(out, "  m->pc = 0%.5o;\n", next);
+      }
+      break;
+    }
+
+    if( addr == last ){
+      if( (word & IF_MASK) == AND || (word & IF_MASK) == TAD ||
+          (word & IF_MASK) == DCA ){
+        fprintf(out, "  m->pc = 0%.5o;\n", next);
+      }
+      break;
+    }
+  }
+
+  fprintf(out, "\n  m->ac = a;\n  m->mq = q;\n  m->time += %ld;\n", time);
+  fprintf(out, "  *count = %d;\n  return res;\n}\n\n", n);
+}
+
+
+int main(int argc, char **argv)
+{
+  short start_pc;
+
+  if( argc != 3 ){
+    printf("Usage: %s <core file> <output.c>\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  if( ! read_core(argv[1], &start_pc) ){
+    exit(EXIT_FAILURE);
+  }
+
+  find_blocks(start_pc);
+
+  FILE *out = fopen(argv[2], "w");
+  if( out == NULL ){
+    perror("Unable to open output file");
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(out, "// Generated by 8aot from %s, do not edit.\n\n", argv[1]);
+  fprintf(out, "#include \"cpu.h\"\n#include \"pdp8.h\"\n#include \"aot.h\"\n\n");
+
+  int blocks = 0;
+  for( int addr = 0; addr < MEMSIZE; addr++ ){
+    if( is_block[addr] ){
+      emit_block(out, addr);
+      blocks++;
+    }
+  }
+
+  for( int page = 0; page < PAGES; page++ ){
+    int used = 0;
+    for( int i = 0; i <= WORD_MASK; i++ ){
+      used |= is_block[(page << 7) | i];
+    }
+    if( ! used ){
+      continue;
+    }
+    fprintf(out, "static const aot_block_fn page%.3o[0200] = {\n", page);
+    for( int i = 0; i <= WORD_MASK; i++ ){
+      short addr = (page << 7) | i;
+      if( is_block[addr] ){
+        fprintf(out, "  [0%.3o] = b%.5o,\n", i, addr);
+      }
+    }
+    fprintf(out, "};\n\n");
+  }
+
+  fprintf(out, "const aot_block_fn * const aot_pages[PAGES] = {\n");
+  for( int page = 0; page < PAGES; page++ ){
+    for( int i = 0; i <= WORD_MASK; i++ ){
+      if( is_block[(page << 7) | i] ){
+        fprintf(out, "  [0%.3o] = page%.3o,\n", page, page);
+        break;
+      }
+    }
+  }
+  fprintf(out, "};\n");
+
+  if( fclose(out) ){
+    perror("Unable to close output file");
+    exit(EXIT_FAILURE);
+  }
+
+  printf("%d blocks translated\n", blocks);
+  exit(EXIT_SUCCESS);
+}
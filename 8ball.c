@@ -8,6 +8,8 @@
 
 #include "console.h"
 #include "machine.h"
+#include <stdio.h>
+#include <stdlib.h>
 #define UNUSED(x) (void)(x);
 
 int main (int argc, char **argv)
@@ -16,6 +18,12 @@ int main (int argc, char **argv)
   UNUSED(argc);
   UNUSED(argv);
   machine_srv();
+#elif defined(TRACE_DECODER)
+  if( argc != 2 ){
+    printf("Usage: %s <trace file>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  return console_decode_trace(argv[1]) ? EXIT_SUCCESS : EXIT_FAILURE;
 #else
   console_setup(argc, argv);
   console();
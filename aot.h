@@ -0,0 +1,26 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _AOT_H_
+#define _AOT_H_
+
+// Interface between the emulator and C code generated by 8aot. Each
+// translated basic block is a function that executes the block and
+// sets count to the number of instructions executed. count holds the
+// most instructions to run on entry. count is set to zero, and nothing
+// is executed, if any word of the block has been modified since
+// translation, a breakpoint is set inside it, the block is longer than
+// count or an event is due before its last instruction. The return
+// value is -1 on HLT, otherwise 0.
+typedef int (*aot_block_fn)(pdp8_machine_t *m, int *count);
+
+// One table of block entry points per page, NULL for pages without
+// translated code.
+extern const aot_block_fn * const aot_pages[PAGES];
+
+#endif // _AOT_H_
@@ -0,0 +1,15565 @@
+// Generated by 8aot from tests/maindec-8e-d1ha-pb.core, do not edit.
+
+#include "cpu.h"
+#include "pdp8.h"
+#include "aot.h"
+
+static int b00000(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000000] != 00000 ||
+      m->mem[000001] != 05001 || m->breakpoints[000001] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00000  0000
+  CPU_COUNT(m, 000000, 00000);
+  COVERAGE_SET(m, 000000);
+  HISTORY_ADD(m, 000000, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 00001  5001
+  CPU_COUNT(m, 000001, 05001);
+  COVERAGE_SET(m, 000001);
+  HISTORY_ADD(m, 000001, 05001, a, q);
+  cpma = 000001;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00001(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000001] != 05001 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00001  5001
+  CPU_COUNT(m, 000001, 05001);
+  COVERAGE_SET(m, 000001);
+  HISTORY_ADD(m, 000001, 05001, a, q);
+  cpma = 000001;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00200(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000200] != 07604 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00200  7604
+  CPU_COUNT(m, 000200, 07604);
+  COVERAGE_SET(m, 000200);
+  HISTORY_ADD(m, 000200, 07604, a, q);
+  cond = 0;
+  a &= LINK_MASK;
+  m->pc = cond ? 000202 : 000201;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    a |= m->sr;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00201(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000201] != 07510 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00201  7510
+  CPU_COUNT(m, 000201, 07510);
+  COVERAGE_SET(m, 000201);
+  HISTORY_ADD(m, 000201, 07510, a, q);
+  cond = 0 || (a & SIGN_BIT_MASK);
+  m->pc = ! cond ? 000203 : 000202;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00202(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000202] != 05552 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00202  5552
+  CPU_COUNT(m, 000202, 05552);
+  COVERAGE_SET(m, 000202);
+  HISTORY_ADD(m, 000202, 05552, a, q);
+  cpma = 000000 | (m->mem[000152] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b00203(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000203] != 07300 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00203  7300
+  CPU_COUNT(m, 000203, 07300);
+  COVERAGE_SET(m, 000203);
+  HISTORY_ADD(m, 000203, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  m->pc = 000204;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00206(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000206] != 01037 ||
+      m->mem[000207] != 03001 || m->breakpoints[000207] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00206  1037
+  CPU_COUNT(m, 000206, 01037);
+  COVERAGE_SET(m, 000206);
+  HISTORY_ADD(m, 000206, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00207  3001
+  CPU_COUNT(m, 000207, 03001);
+  COVERAGE_SET(m, 000207);
+  HISTORY_ADD(m, 000207, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000210;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5200;
+  *count = 2;
+  return res;
+}
+
+static int b00207(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000207] != 03001 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00207  3001
+  CPU_COUNT(m, 000207, 03001);
+  COVERAGE_SET(m, 000207);
+  HISTORY_ADD(m, 000207, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000210;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00213(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000213] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00213  7450
+  CPU_COUNT(m, 000213, 07450);
+  COVERAGE_SET(m, 000213);
+  HISTORY_ADD(m, 000213, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000215 : 000214;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00214(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000214] != 05220 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00214  5220
+  CPU_COUNT(m, 000214, 05220);
+  COVERAGE_SET(m, 000214);
+  HISTORY_ADD(m, 000214, 05220, a, q);
+  cpma = 000220;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00215(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000215] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00215  7402
+  CPU_COUNT(m, 000215, 07402);
+  COVERAGE_SET(m, 000215);
+  HISTORY_ADD(m, 000215, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000217 : 000216;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00216(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000216] != 07200 ||
+      m->mem[000217] != 05211 || m->breakpoints[000217] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00216  7200
+  CPU_COUNT(m, 000216, 07200);
+  COVERAGE_SET(m, 000216);
+  HISTORY_ADD(m, 000216, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00217  5211
+  CPU_COUNT(m, 000217, 05211);
+  COVERAGE_SET(m, 000217);
+  HISTORY_ADD(m, 000217, 05211, a, q);
+  cpma = 000211;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00217(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000217] != 05211 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00217  5211
+  CPU_COUNT(m, 000217, 05211);
+  COVERAGE_SET(m, 000217);
+  HISTORY_ADD(m, 000217, 05211, a, q);
+  cpma = 000211;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00220(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000220] != 01050 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00220  1050
+  CPU_COUNT(m, 000220, 01050);
+  COVERAGE_SET(m, 000220);
+  HISTORY_ADD(m, 000220, 01050, a, q);
+  cpma = 000050;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000221;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00223(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000223] != 07040 ||
+      m->mem[000224] != 07450 || m->breakpoints[000224] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00223  7040
+  CPU_COUNT(m, 000223, 07040);
+  COVERAGE_SET(m, 000223);
+  HISTORY_ADD(m, 000223, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00224  7450
+  CPU_COUNT(m, 000224, 07450);
+  COVERAGE_SET(m, 000224);
+  HISTORY_ADD(m, 000224, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000226 : 000225;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00224(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000224] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00224  7450
+  CPU_COUNT(m, 000224, 07450);
+  COVERAGE_SET(m, 000224);
+  HISTORY_ADD(m, 000224, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000226 : 000225;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00225(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000225] != 05231 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00225  5231
+  CPU_COUNT(m, 000225, 05231);
+  COVERAGE_SET(m, 000225);
+  HISTORY_ADD(m, 000225, 05231, a, q);
+  cpma = 000231;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00226(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000226] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00226  7402
+  CPU_COUNT(m, 000226, 07402);
+  COVERAGE_SET(m, 000226);
+  HISTORY_ADD(m, 000226, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000230 : 000227;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00227(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000227] != 07200 ||
+      m->mem[000230] != 05220 || m->breakpoints[000230] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00227  7200
+  CPU_COUNT(m, 000227, 07200);
+  COVERAGE_SET(m, 000227);
+  HISTORY_ADD(m, 000227, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00230  5220
+  CPU_COUNT(m, 000230, 05220);
+  COVERAGE_SET(m, 000230);
+  HISTORY_ADD(m, 000230, 05220, a, q);
+  cpma = 000220;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00230(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000230] != 05220 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00230  5220
+  CPU_COUNT(m, 000230, 05220);
+  COVERAGE_SET(m, 000230);
+  HISTORY_ADD(m, 000230, 05220, a, q);
+  cpma = 000220;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00231(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000231] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00231  2027
+  CPU_COUNT(m, 000231, 02027);
+  COVERAGE_SET(m, 000231);
+  HISTORY_ADD(m, 000231, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000233 : 000232;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00232(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000232] != 05211 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00232  5211
+  CPU_COUNT(m, 000232, 05211);
+  COVERAGE_SET(m, 000232);
+  HISTORY_ADD(m, 000232, 05211, a, q);
+  cpma = 000211;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00233(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000233] != 07200 ||
+      m->mem[000234] != 03027 || m->breakpoints[000234] ||
+      m->mem[000235] != 01051 || m->breakpoints[000235] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00233  7200
+  CPU_COUNT(m, 000233, 07200);
+  COVERAGE_SET(m, 000233);
+  HISTORY_ADD(m, 000233, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00234  3027
+  CPU_COUNT(m, 000234, 03027);
+  COVERAGE_SET(m, 000234);
+  HISTORY_ADD(m, 000234, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000233 && cpma <= 000235 ){
+    m->ac = a; m->mq = q; m->pc = 000235; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00235  1051
+  CPU_COUNT(m, 000235, 01051);
+  COVERAGE_SET(m, 000235);
+  HISTORY_ADD(m, 000235, 01051, a, q);
+  cpma = 000051;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000236;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b00235(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000235] != 01051 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00235  1051
+  CPU_COUNT(m, 000235, 01051);
+  COVERAGE_SET(m, 000235);
+  HISTORY_ADD(m, 000235, 01051, a, q);
+  cpma = 000051;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000236;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00240(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000240] != 07040 ||
+      m->mem[000241] != 07450 || m->breakpoints[000241] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00240  7040
+  CPU_COUNT(m, 000240, 07040);
+  COVERAGE_SET(m, 000240);
+  HISTORY_ADD(m, 000240, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00241  7450
+  CPU_COUNT(m, 000241, 07450);
+  COVERAGE_SET(m, 000241);
+  HISTORY_ADD(m, 000241, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000243 : 000242;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00241(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000241] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00241  7450
+  CPU_COUNT(m, 000241, 07450);
+  COVERAGE_SET(m, 000241);
+  HISTORY_ADD(m, 000241, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000243 : 000242;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00242(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000242] != 05246 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00242  5246
+  CPU_COUNT(m, 000242, 05246);
+  COVERAGE_SET(m, 000242);
+  HISTORY_ADD(m, 000242, 05246, a, q);
+  cpma = 000246;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00243(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000243] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00243  7402
+  CPU_COUNT(m, 000243, 07402);
+  COVERAGE_SET(m, 000243);
+  HISTORY_ADD(m, 000243, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000245 : 000244;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00244(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000244] != 07200 ||
+      m->mem[000245] != 05235 || m->breakpoints[000245] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00244  7200
+  CPU_COUNT(m, 000244, 07200);
+  COVERAGE_SET(m, 000244);
+  HISTORY_ADD(m, 000244, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00245  5235
+  CPU_COUNT(m, 000245, 05235);
+  COVERAGE_SET(m, 000245);
+  HISTORY_ADD(m, 000245, 05235, a, q);
+  cpma = 000235;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00245(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000245] != 05235 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00245  5235
+  CPU_COUNT(m, 000245, 05235);
+  COVERAGE_SET(m, 000245);
+  HISTORY_ADD(m, 000245, 05235, a, q);
+  cpma = 000235;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00246(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000246] != 01052 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00246  1052
+  CPU_COUNT(m, 000246, 01052);
+  COVERAGE_SET(m, 000246);
+  HISTORY_ADD(m, 000246, 01052, a, q);
+  cpma = 000052;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000247;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00251(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000251] != 07040 ||
+      m->mem[000252] != 07450 || m->breakpoints[000252] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00251  7040
+  CPU_COUNT(m, 000251, 07040);
+  COVERAGE_SET(m, 000251);
+  HISTORY_ADD(m, 000251, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00252  7450
+  CPU_COUNT(m, 000252, 07450);
+  COVERAGE_SET(m, 000252);
+  HISTORY_ADD(m, 000252, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000254 : 000253;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00252(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000252] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00252  7450
+  CPU_COUNT(m, 000252, 07450);
+  COVERAGE_SET(m, 000252);
+  HISTORY_ADD(m, 000252, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000254 : 000253;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00253(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000253] != 05257 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00253  5257
+  CPU_COUNT(m, 000253, 05257);
+  COVERAGE_SET(m, 000253);
+  HISTORY_ADD(m, 000253, 05257, a, q);
+  cpma = 000257;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00254(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000254] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00254  7402
+  CPU_COUNT(m, 000254, 07402);
+  COVERAGE_SET(m, 000254);
+  HISTORY_ADD(m, 000254, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000256 : 000255;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00255(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000255] != 07200 ||
+      m->mem[000256] != 05246 || m->breakpoints[000256] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00255  7200
+  CPU_COUNT(m, 000255, 07200);
+  COVERAGE_SET(m, 000255);
+  HISTORY_ADD(m, 000255, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00256  5246
+  CPU_COUNT(m, 000256, 05246);
+  COVERAGE_SET(m, 000256);
+  HISTORY_ADD(m, 000256, 05246, a, q);
+  cpma = 000246;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00256(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000256] != 05246 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00256  5246
+  CPU_COUNT(m, 000256, 05246);
+  COVERAGE_SET(m, 000256);
+  HISTORY_ADD(m, 000256, 05246, a, q);
+  cpma = 000246;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00257(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000257] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00257  2027
+  CPU_COUNT(m, 000257, 02027);
+  COVERAGE_SET(m, 000257);
+  HISTORY_ADD(m, 000257, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000261 : 000260;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00260(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000260] != 05235 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00260  5235
+  CPU_COUNT(m, 000260, 05235);
+  COVERAGE_SET(m, 000260);
+  HISTORY_ADD(m, 000260, 05235, a, q);
+  cpma = 000235;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00261(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000261] != 07200 ||
+      m->mem[000262] != 03027 || m->breakpoints[000262] ||
+      m->mem[000263] != 01053 || m->breakpoints[000263] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00261  7200
+  CPU_COUNT(m, 000261, 07200);
+  COVERAGE_SET(m, 000261);
+  HISTORY_ADD(m, 000261, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00262  3027
+  CPU_COUNT(m, 000262, 03027);
+  COVERAGE_SET(m, 000262);
+  HISTORY_ADD(m, 000262, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000261 && cpma <= 000263 ){
+    m->ac = a; m->mq = q; m->pc = 000263; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00263  1053
+  CPU_COUNT(m, 000263, 01053);
+  COVERAGE_SET(m, 000263);
+  HISTORY_ADD(m, 000263, 01053, a, q);
+  cpma = 000053;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000264;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b00263(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000263] != 01053 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00263  1053
+  CPU_COUNT(m, 000263, 01053);
+  COVERAGE_SET(m, 000263);
+  HISTORY_ADD(m, 000263, 01053, a, q);
+  cpma = 000053;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000264;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00266(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000266] != 07040 ||
+      m->mem[000267] != 07450 || m->breakpoints[000267] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00266  7040
+  CPU_COUNT(m, 000266, 07040);
+  COVERAGE_SET(m, 000266);
+  HISTORY_ADD(m, 000266, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00267  7450
+  CPU_COUNT(m, 000267, 07450);
+  COVERAGE_SET(m, 000267);
+  HISTORY_ADD(m, 000267, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000271 : 000270;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00267(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000267] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00267  7450
+  CPU_COUNT(m, 000267, 07450);
+  COVERAGE_SET(m, 000267);
+  HISTORY_ADD(m, 000267, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000271 : 000270;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00270(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000270] != 05274 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00270  5274
+  CPU_COUNT(m, 000270, 05274);
+  COVERAGE_SET(m, 000270);
+  HISTORY_ADD(m, 000270, 05274, a, q);
+  cpma = 000274;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00271(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000271] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00271  7402
+  CPU_COUNT(m, 000271, 07402);
+  COVERAGE_SET(m, 000271);
+  HISTORY_ADD(m, 000271, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000273 : 000272;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00272(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000272] != 07200 ||
+      m->mem[000273] != 05263 || m->breakpoints[000273] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00272  7200
+  CPU_COUNT(m, 000272, 07200);
+  COVERAGE_SET(m, 000272);
+  HISTORY_ADD(m, 000272, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00273  5263
+  CPU_COUNT(m, 000273, 05263);
+  COVERAGE_SET(m, 000273);
+  HISTORY_ADD(m, 000273, 05263, a, q);
+  cpma = 000263;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00273(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000273] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00273  5263
+  CPU_COUNT(m, 000273, 05263);
+  COVERAGE_SET(m, 000273);
+  HISTORY_ADD(m, 000273, 05263, a, q);
+  cpma = 000263;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00274(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000274] != 01054 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00274  1054
+  CPU_COUNT(m, 000274, 01054);
+  COVERAGE_SET(m, 000274);
+  HISTORY_ADD(m, 000274, 01054, a, q);
+  cpma = 000054;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000275;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00277(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000277] != 07040 ||
+      m->mem[000300] != 07450 || m->breakpoints[000300] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00277  7040
+  CPU_COUNT(m, 000277, 07040);
+  COVERAGE_SET(m, 000277);
+  HISTORY_ADD(m, 000277, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00300  7450
+  CPU_COUNT(m, 000300, 07450);
+  COVERAGE_SET(m, 000300);
+  HISTORY_ADD(m, 000300, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000302 : 000301;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00300(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000300] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00300  7450
+  CPU_COUNT(m, 000300, 07450);
+  COVERAGE_SET(m, 000300);
+  HISTORY_ADD(m, 000300, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000302 : 000301;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00301(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000301] != 05305 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00301  5305
+  CPU_COUNT(m, 000301, 05305);
+  COVERAGE_SET(m, 000301);
+  HISTORY_ADD(m, 000301, 05305, a, q);
+  cpma = 000305;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00302(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000302] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00302  7402
+  CPU_COUNT(m, 000302, 07402);
+  COVERAGE_SET(m, 000302);
+  HISTORY_ADD(m, 000302, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000304 : 000303;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00303(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000303] != 07200 ||
+      m->mem[000304] != 05274 || m->breakpoints[000304] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00303  7200
+  CPU_COUNT(m, 000303, 07200);
+  COVERAGE_SET(m, 000303);
+  HISTORY_ADD(m, 000303, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00304  5274
+  CPU_COUNT(m, 000304, 05274);
+  COVERAGE_SET(m, 000304);
+  HISTORY_ADD(m, 000304, 05274, a, q);
+  cpma = 000274;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00304(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000304] != 05274 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00304  5274
+  CPU_COUNT(m, 000304, 05274);
+  COVERAGE_SET(m, 000304);
+  HISTORY_ADD(m, 000304, 05274, a, q);
+  cpma = 000274;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00305(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000305] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00305  2027
+  CPU_COUNT(m, 000305, 02027);
+  COVERAGE_SET(m, 000305);
+  HISTORY_ADD(m, 000305, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000307 : 000306;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00306(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000306] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00306  5263
+  CPU_COUNT(m, 000306, 05263);
+  COVERAGE_SET(m, 000306);
+  HISTORY_ADD(m, 000306, 05263, a, q);
+  cpma = 000263;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00307(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000307] != 07200 ||
+      m->mem[000310] != 03027 || m->breakpoints[000310] ||
+      m->mem[000311] != 01055 || m->breakpoints[000311] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00307  7200
+  CPU_COUNT(m, 000307, 07200);
+  COVERAGE_SET(m, 000307);
+  HISTORY_ADD(m, 000307, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00310  3027
+  CPU_COUNT(m, 000310, 03027);
+  COVERAGE_SET(m, 000310);
+  HISTORY_ADD(m, 000310, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000307 && cpma <= 000311 ){
+    m->ac = a; m->mq = q; m->pc = 000311; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00311  1055
+  CPU_COUNT(m, 000311, 01055);
+  COVERAGE_SET(m, 000311);
+  HISTORY_ADD(m, 000311, 01055, a, q);
+  cpma = 000055;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000312;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b00311(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000311] != 01055 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00311  1055
+  CPU_COUNT(m, 000311, 01055);
+  COVERAGE_SET(m, 000311);
+  HISTORY_ADD(m, 000311, 01055, a, q);
+  cpma = 000055;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000312;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00314(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000314] != 07040 ||
+      m->mem[000315] != 07450 || m->breakpoints[000315] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00314  7040
+  CPU_COUNT(m, 000314, 07040);
+  COVERAGE_SET(m, 000314);
+  HISTORY_ADD(m, 000314, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00315  7450
+  CPU_COUNT(m, 000315, 07450);
+  COVERAGE_SET(m, 000315);
+  HISTORY_ADD(m, 000315, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000317 : 000316;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00315(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000315] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00315  7450
+  CPU_COUNT(m, 000315, 07450);
+  COVERAGE_SET(m, 000315);
+  HISTORY_ADD(m, 000315, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000317 : 000316;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00316(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000316] != 05322 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00316  5322
+  CPU_COUNT(m, 000316, 05322);
+  COVERAGE_SET(m, 000316);
+  HISTORY_ADD(m, 000316, 05322, a, q);
+  cpma = 000322;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00317(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000317] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00317  7402
+  CPU_COUNT(m, 000317, 07402);
+  COVERAGE_SET(m, 000317);
+  HISTORY_ADD(m, 000317, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000321 : 000320;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00320(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000320] != 07200 ||
+      m->mem[000321] != 05311 || m->breakpoints[000321] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00320  7200
+  CPU_COUNT(m, 000320, 07200);
+  COVERAGE_SET(m, 000320);
+  HISTORY_ADD(m, 000320, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00321  5311
+  CPU_COUNT(m, 000321, 05311);
+  COVERAGE_SET(m, 000321);
+  HISTORY_ADD(m, 000321, 05311, a, q);
+  cpma = 000311;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00321(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000321] != 05311 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00321  5311
+  CPU_COUNT(m, 000321, 05311);
+  COVERAGE_SET(m, 000321);
+  HISTORY_ADD(m, 000321, 05311, a, q);
+  cpma = 000311;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00322(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000322] != 01056 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00322  1056
+  CPU_COUNT(m, 000322, 01056);
+  COVERAGE_SET(m, 000322);
+  HISTORY_ADD(m, 000322, 01056, a, q);
+  cpma = 000056;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000323;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00325(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000325] != 07040 ||
+      m->mem[000326] != 07450 || m->breakpoints[000326] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00325  7040
+  CPU_COUNT(m, 000325, 07040);
+  COVERAGE_SET(m, 000325);
+  HISTORY_ADD(m, 000325, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00326  7450
+  CPU_COUNT(m, 000326, 07450);
+  COVERAGE_SET(m, 000326);
+  HISTORY_ADD(m, 000326, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000330 : 000327;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00326(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000326] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00326  7450
+  CPU_COUNT(m, 000326, 07450);
+  COVERAGE_SET(m, 000326);
+  HISTORY_ADD(m, 000326, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000330 : 000327;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00327(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000327] != 05333 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00327  5333
+  CPU_COUNT(m, 000327, 05333);
+  COVERAGE_SET(m, 000327);
+  HISTORY_ADD(m, 000327, 05333, a, q);
+  cpma = 000333;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00330(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000330] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00330  7402
+  CPU_COUNT(m, 000330, 07402);
+  COVERAGE_SET(m, 000330);
+  HISTORY_ADD(m, 000330, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000332 : 000331;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00331(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000331] != 07200 ||
+      m->mem[000332] != 05322 || m->breakpoints[000332] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00331  7200
+  CPU_COUNT(m, 000331, 07200);
+  COVERAGE_SET(m, 000331);
+  HISTORY_ADD(m, 000331, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00332  5322
+  CPU_COUNT(m, 000332, 05322);
+  COVERAGE_SET(m, 000332);
+  HISTORY_ADD(m, 000332, 05322, a, q);
+  cpma = 000322;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00332(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000332] != 05322 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00332  5322
+  CPU_COUNT(m, 000332, 05322);
+  COVERAGE_SET(m, 000332);
+  HISTORY_ADD(m, 000332, 05322, a, q);
+  cpma = 000322;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00333(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000333] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00333  2027
+  CPU_COUNT(m, 000333, 02027);
+  COVERAGE_SET(m, 000333);
+  HISTORY_ADD(m, 000333, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000335 : 000334;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00334(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000334] != 05311 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00334  5311
+  CPU_COUNT(m, 000334, 05311);
+  COVERAGE_SET(m, 000334);
+  HISTORY_ADD(m, 000334, 05311, a, q);
+  cpma = 000311;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00336(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000336] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00336  7402
+  CPU_COUNT(m, 000336, 07402);
+  COVERAGE_SET(m, 000336);
+  HISTORY_ADD(m, 000336, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000340 : 000337;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00340(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000340] != 01020 ||
+      m->mem[000341] != 03001 || m->breakpoints[000341] ||
+      m->mem[000342] != 03027 || m->breakpoints[000342] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 5200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00340  1020
+  CPU_COUNT(m, 000340, 01020);
+  COVERAGE_SET(m, 000340);
+  HISTORY_ADD(m, 000340, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00341  3001
+  CPU_COUNT(m, 000341, 03001);
+  COVERAGE_SET(m, 000341);
+  HISTORY_ADD(m, 000341, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000340 && cpma <= 000342 ){
+    m->ac = a; m->mq = q; m->pc = 000342; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 00342  3027
+  CPU_COUNT(m, 000342, 03027);
+  COVERAGE_SET(m, 000342);
+  HISTORY_ADD(m, 000342, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000343;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 7800;
+  *count = 3;
+  return res;
+}
+
+static int b00341(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000341] != 03001 ||
+      m->mem[000342] != 03027 || m->breakpoints[000342] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00341  3001
+  CPU_COUNT(m, 000341, 03001);
+  COVERAGE_SET(m, 000341);
+  HISTORY_ADD(m, 000341, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000341 && cpma <= 000342 ){
+    m->ac = a; m->mq = q; m->pc = 000342; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 00342  3027
+  CPU_COUNT(m, 000342, 03027);
+  COVERAGE_SET(m, 000342);
+  HISTORY_ADD(m, 000342, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000343;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5200;
+  *count = 2;
+  return res;
+}
+
+static int b00344(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000344] != 04422 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00344  4422
+  CPU_COUNT(m, 000344, 04422);
+  COVERAGE_SET(m, 000344);
+  HISTORY_ADD(m, 000344, 04422, a, q);
+  cpma = 000000 | (m->mem[000022] & B12_MASK);
+  m->pc = 000345;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b00346(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000346] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00346  7200
+  CPU_COUNT(m, 000346, 07200);
+  COVERAGE_SET(m, 000346);
+  HISTORY_ADD(m, 000346, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000347;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00350(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000350] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00350  7450
+  CPU_COUNT(m, 000350, 07450);
+  COVERAGE_SET(m, 000350);
+  HISTORY_ADD(m, 000350, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000352 : 000351;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00351(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000351] != 05354 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00351  5354
+  CPU_COUNT(m, 000351, 05354);
+  COVERAGE_SET(m, 000351);
+  HISTORY_ADD(m, 000351, 05354, a, q);
+  cpma = 000354;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00352(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000352] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00352  7402
+  CPU_COUNT(m, 000352, 07402);
+  COVERAGE_SET(m, 000352);
+  HISTORY_ADD(m, 000352, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000354 : 000353;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00353(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000353] != 05345 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00353  5345
+  CPU_COUNT(m, 000353, 05345);
+  COVERAGE_SET(m, 000353);
+  HISTORY_ADD(m, 000353, 05345, a, q);
+  cpma = 000345;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00356(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000356] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00356  7200
+  CPU_COUNT(m, 000356, 07200);
+  COVERAGE_SET(m, 000356);
+  HISTORY_ADD(m, 000356, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000357;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00360(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000360] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00360  7450
+  CPU_COUNT(m, 000360, 07450);
+  COVERAGE_SET(m, 000360);
+  HISTORY_ADD(m, 000360, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000362 : 000361;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00361(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000361] != 05364 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00361  5364
+  CPU_COUNT(m, 000361, 05364);
+  COVERAGE_SET(m, 000361);
+  HISTORY_ADD(m, 000361, 05364, a, q);
+  cpma = 000364;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00362(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000362] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00362  7402
+  CPU_COUNT(m, 000362, 07402);
+  COVERAGE_SET(m, 000362);
+  HISTORY_ADD(m, 000362, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000364 : 000363;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00363(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000363] != 05354 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00363  5354
+  CPU_COUNT(m, 000363, 05354);
+  COVERAGE_SET(m, 000363);
+  HISTORY_ADD(m, 000363, 05354, a, q);
+  cpma = 000354;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00364(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000364] != 01057 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00364  1057
+  CPU_COUNT(m, 000364, 01057);
+  COVERAGE_SET(m, 000364);
+  HISTORY_ADD(m, 000364, 01057, a, q);
+  cpma = 000057;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000365;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00366(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000366] != 07040 ||
+      m->mem[000367] != 07450 || m->breakpoints[000367] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00366  7040
+  CPU_COUNT(m, 000366, 07040);
+  COVERAGE_SET(m, 000366);
+  HISTORY_ADD(m, 000366, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00367  7450
+  CPU_COUNT(m, 000367, 07450);
+  COVERAGE_SET(m, 000367);
+  HISTORY_ADD(m, 000367, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000371 : 000370;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00367(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000367] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00367  7450
+  CPU_COUNT(m, 000367, 07450);
+  COVERAGE_SET(m, 000367);
+  HISTORY_ADD(m, 000367, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000371 : 000370;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00370(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000370] != 05373 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00370  5373
+  CPU_COUNT(m, 000370, 05373);
+  COVERAGE_SET(m, 000370);
+  HISTORY_ADD(m, 000370, 05373, a, q);
+  cpma = 000373;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00371(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000371] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00371  7402
+  CPU_COUNT(m, 000371, 07402);
+  COVERAGE_SET(m, 000371);
+  HISTORY_ADD(m, 000371, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000373 : 000372;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00372(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000372] != 05354 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00372  5354
+  CPU_COUNT(m, 000372, 05354);
+  COVERAGE_SET(m, 000372);
+  HISTORY_ADD(m, 000372, 05354, a, q);
+  cpma = 000354;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00373(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000373] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00373  2027
+  CPU_COUNT(m, 000373, 02027);
+  COVERAGE_SET(m, 000373);
+  HISTORY_ADD(m, 000373, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000375 : 000374;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00374(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000374] != 05345 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00374  5345
+  CPU_COUNT(m, 000374, 05345);
+  COVERAGE_SET(m, 000374);
+  HISTORY_ADD(m, 000374, 05345, a, q);
+  cpma = 000345;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00375(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000375] != 05776 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00375  5776
+  CPU_COUNT(m, 000375, 05776);
+  COVERAGE_SET(m, 000375);
+  HISTORY_ADD(m, 000375, 05776, a, q);
+  cpma = 000000 | (m->mem[000376] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b00400(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000400] != 07200 ||
+      m->mem[000401] != 03027 || m->breakpoints[000401] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00400  7200
+  CPU_COUNT(m, 000400, 07200);
+  COVERAGE_SET(m, 000400);
+  HISTORY_ADD(m, 000400, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00401  3027
+  CPU_COUNT(m, 000401, 03027);
+  COVERAGE_SET(m, 000401);
+  HISTORY_ADD(m, 000401, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000402;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00404(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000404] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00404  7200
+  CPU_COUNT(m, 000404, 07200);
+  COVERAGE_SET(m, 000404);
+  HISTORY_ADD(m, 000404, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000405;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00406(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000406] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00406  7450
+  CPU_COUNT(m, 000406, 07450);
+  COVERAGE_SET(m, 000406);
+  HISTORY_ADD(m, 000406, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000410 : 000407;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00407(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000407] != 05212 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00407  5212
+  CPU_COUNT(m, 000407, 05212);
+  COVERAGE_SET(m, 000407);
+  HISTORY_ADD(m, 000407, 05212, a, q);
+  cpma = 000412;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00410(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000410] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00410  7402
+  CPU_COUNT(m, 000410, 07402);
+  COVERAGE_SET(m, 000410);
+  HISTORY_ADD(m, 000410, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000412 : 000411;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00411(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000411] != 05202 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00411  5202
+  CPU_COUNT(m, 000411, 05202);
+  COVERAGE_SET(m, 000411);
+  HISTORY_ADD(m, 000411, 05202, a, q);
+  cpma = 000402;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00412(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000412] != 01060 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00412  1060
+  CPU_COUNT(m, 000412, 01060);
+  COVERAGE_SET(m, 000412);
+  HISTORY_ADD(m, 000412, 01060, a, q);
+  cpma = 000060;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000413;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00414(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000414] != 07040 ||
+      m->mem[000415] != 07450 || m->breakpoints[000415] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00414  7040
+  CPU_COUNT(m, 000414, 07040);
+  COVERAGE_SET(m, 000414);
+  HISTORY_ADD(m, 000414, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00415  7450
+  CPU_COUNT(m, 000415, 07450);
+  COVERAGE_SET(m, 000415);
+  HISTORY_ADD(m, 000415, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000417 : 000416;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00415(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000415] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00415  7450
+  CPU_COUNT(m, 000415, 07450);
+  COVERAGE_SET(m, 000415);
+  HISTORY_ADD(m, 000415, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000417 : 000416;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00416(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000416] != 05221 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00416  5221
+  CPU_COUNT(m, 000416, 05221);
+  COVERAGE_SET(m, 000416);
+  HISTORY_ADD(m, 000416, 05221, a, q);
+  cpma = 000421;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00417(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000417] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00417  7402
+  CPU_COUNT(m, 000417, 07402);
+  COVERAGE_SET(m, 000417);
+  HISTORY_ADD(m, 000417, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000421 : 000420;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00420(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000420] != 05202 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00420  5202
+  CPU_COUNT(m, 000420, 05202);
+  COVERAGE_SET(m, 000420);
+  HISTORY_ADD(m, 000420, 05202, a, q);
+  cpma = 000402;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00423(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000423] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00423  7200
+  CPU_COUNT(m, 000423, 07200);
+  COVERAGE_SET(m, 000423);
+  HISTORY_ADD(m, 000423, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000424;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00425(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000425] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00425  7450
+  CPU_COUNT(m, 000425, 07450);
+  COVERAGE_SET(m, 000425);
+  HISTORY_ADD(m, 000425, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000427 : 000426;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00426(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000426] != 05231 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00426  5231
+  CPU_COUNT(m, 000426, 05231);
+  COVERAGE_SET(m, 000426);
+  HISTORY_ADD(m, 000426, 05231, a, q);
+  cpma = 000431;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00427(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000427] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00427  7402
+  CPU_COUNT(m, 000427, 07402);
+  COVERAGE_SET(m, 000427);
+  HISTORY_ADD(m, 000427, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000431 : 000430;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00430(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000430] != 05221 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00430  5221
+  CPU_COUNT(m, 000430, 05221);
+  COVERAGE_SET(m, 000430);
+  HISTORY_ADD(m, 000430, 05221, a, q);
+  cpma = 000421;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00431(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000431] != 01061 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00431  1061
+  CPU_COUNT(m, 000431, 01061);
+  COVERAGE_SET(m, 000431);
+  HISTORY_ADD(m, 000431, 01061, a, q);
+  cpma = 000061;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000432;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00433(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000433] != 07040 ||
+      m->mem[000434] != 07450 || m->breakpoints[000434] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00433  7040
+  CPU_COUNT(m, 000433, 07040);
+  COVERAGE_SET(m, 000433);
+  HISTORY_ADD(m, 000433, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00434  7450
+  CPU_COUNT(m, 000434, 07450);
+  COVERAGE_SET(m, 000434);
+  HISTORY_ADD(m, 000434, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000436 : 000435;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00434(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000434] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00434  7450
+  CPU_COUNT(m, 000434, 07450);
+  COVERAGE_SET(m, 000434);
+  HISTORY_ADD(m, 000434, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000436 : 000435;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00435(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000435] != 05240 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00435  5240
+  CPU_COUNT(m, 000435, 05240);
+  COVERAGE_SET(m, 000435);
+  HISTORY_ADD(m, 000435, 05240, a, q);
+  cpma = 000440;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00436(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000436] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00436  7402
+  CPU_COUNT(m, 000436, 07402);
+  COVERAGE_SET(m, 000436);
+  HISTORY_ADD(m, 000436, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000440 : 000437;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00437(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000437] != 05221 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00437  5221
+  CPU_COUNT(m, 000437, 05221);
+  COVERAGE_SET(m, 000437);
+  HISTORY_ADD(m, 000437, 05221, a, q);
+  cpma = 000421;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00440(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000440] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00440  2027
+  CPU_COUNT(m, 000440, 02027);
+  COVERAGE_SET(m, 000440);
+  HISTORY_ADD(m, 000440, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000442 : 000441;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00441(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000441] != 05202 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00441  5202
+  CPU_COUNT(m, 000441, 05202);
+  COVERAGE_SET(m, 000441);
+  HISTORY_ADD(m, 000441, 05202, a, q);
+  cpma = 000402;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00442(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000442] != 07200 ||
+      m->mem[000443] != 03027 || m->breakpoints[000443] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00442  7200
+  CPU_COUNT(m, 000442, 07200);
+  COVERAGE_SET(m, 000442);
+  HISTORY_ADD(m, 000442, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00443  3027
+  CPU_COUNT(m, 000443, 03027);
+  COVERAGE_SET(m, 000443);
+  HISTORY_ADD(m, 000443, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000444;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00446(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000446] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00446  7200
+  CPU_COUNT(m, 000446, 07200);
+  COVERAGE_SET(m, 000446);
+  HISTORY_ADD(m, 000446, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000447;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00450(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000450] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00450  7450
+  CPU_COUNT(m, 000450, 07450);
+  COVERAGE_SET(m, 000450);
+  HISTORY_ADD(m, 000450, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000452 : 000451;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00451(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000451] != 05254 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00451  5254
+  CPU_COUNT(m, 000451, 05254);
+  COVERAGE_SET(m, 000451);
+  HISTORY_ADD(m, 000451, 05254, a, q);
+  cpma = 000454;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00452(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000452] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00452  7402
+  CPU_COUNT(m, 000452, 07402);
+  COVERAGE_SET(m, 000452);
+  HISTORY_ADD(m, 000452, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000454 : 000453;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00453(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000453] != 05244 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00453  5244
+  CPU_COUNT(m, 000453, 05244);
+  COVERAGE_SET(m, 000453);
+  HISTORY_ADD(m, 000453, 05244, a, q);
+  cpma = 000444;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00454(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000454] != 01062 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00454  1062
+  CPU_COUNT(m, 000454, 01062);
+  COVERAGE_SET(m, 000454);
+  HISTORY_ADD(m, 000454, 01062, a, q);
+  cpma = 000062;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000455;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00456(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000456] != 07040 ||
+      m->mem[000457] != 07450 || m->breakpoints[000457] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00456  7040
+  CPU_COUNT(m, 000456, 07040);
+  COVERAGE_SET(m, 000456);
+  HISTORY_ADD(m, 000456, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00457  7450
+  CPU_COUNT(m, 000457, 07450);
+  COVERAGE_SET(m, 000457);
+  HISTORY_ADD(m, 000457, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000461 : 000460;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00457(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000457] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00457  7450
+  CPU_COUNT(m, 000457, 07450);
+  COVERAGE_SET(m, 000457);
+  HISTORY_ADD(m, 000457, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000461 : 000460;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00460(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000460] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00460  5263
+  CPU_COUNT(m, 000460, 05263);
+  COVERAGE_SET(m, 000460);
+  HISTORY_ADD(m, 000460, 05263, a, q);
+  cpma = 000463;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00461(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000461] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00461  7402
+  CPU_COUNT(m, 000461, 07402);
+  COVERAGE_SET(m, 000461);
+  HISTORY_ADD(m, 000461, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000463 : 000462;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00462(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000462] != 05244 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00462  5244
+  CPU_COUNT(m, 000462, 05244);
+  COVERAGE_SET(m, 000462);
+  HISTORY_ADD(m, 000462, 05244, a, q);
+  cpma = 000444;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00465(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000465] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00465  7200
+  CPU_COUNT(m, 000465, 07200);
+  COVERAGE_SET(m, 000465);
+  HISTORY_ADD(m, 000465, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000466;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00467(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000467] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00467  7450
+  CPU_COUNT(m, 000467, 07450);
+  COVERAGE_SET(m, 000467);
+  HISTORY_ADD(m, 000467, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000471 : 000470;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00470(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000470] != 05273 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00470  5273
+  CPU_COUNT(m, 000470, 05273);
+  COVERAGE_SET(m, 000470);
+  HISTORY_ADD(m, 000470, 05273, a, q);
+  cpma = 000473;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00471(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000471] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00471  7402
+  CPU_COUNT(m, 000471, 07402);
+  COVERAGE_SET(m, 000471);
+  HISTORY_ADD(m, 000471, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000473 : 000472;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00472(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000472] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00472  5263
+  CPU_COUNT(m, 000472, 05263);
+  COVERAGE_SET(m, 000472);
+  HISTORY_ADD(m, 000472, 05263, a, q);
+  cpma = 000463;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00473(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000473] != 01063 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00473  1063
+  CPU_COUNT(m, 000473, 01063);
+  COVERAGE_SET(m, 000473);
+  HISTORY_ADD(m, 000473, 01063, a, q);
+  cpma = 000063;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000474;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00475(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000475] != 07040 ||
+      m->mem[000476] != 07450 || m->breakpoints[000476] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00475  7040
+  CPU_COUNT(m, 000475, 07040);
+  COVERAGE_SET(m, 000475);
+  HISTORY_ADD(m, 000475, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00476  7450
+  CPU_COUNT(m, 000476, 07450);
+  COVERAGE_SET(m, 000476);
+  HISTORY_ADD(m, 000476, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000500 : 000477;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00476(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000476] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00476  7450
+  CPU_COUNT(m, 000476, 07450);
+  COVERAGE_SET(m, 000476);
+  HISTORY_ADD(m, 000476, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000500 : 000477;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00477(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000477] != 05302 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00477  5302
+  CPU_COUNT(m, 000477, 05302);
+  COVERAGE_SET(m, 000477);
+  HISTORY_ADD(m, 000477, 05302, a, q);
+  cpma = 000502;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00500(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000500] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00500  7402
+  CPU_COUNT(m, 000500, 07402);
+  COVERAGE_SET(m, 000500);
+  HISTORY_ADD(m, 000500, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000502 : 000501;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00501(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000501] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00501  5263
+  CPU_COUNT(m, 000501, 05263);
+  COVERAGE_SET(m, 000501);
+  HISTORY_ADD(m, 000501, 05263, a, q);
+  cpma = 000463;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00502(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000502] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00502  2027
+  CPU_COUNT(m, 000502, 02027);
+  COVERAGE_SET(m, 000502);
+  HISTORY_ADD(m, 000502, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000504 : 000503;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00503(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000503] != 05244 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00503  5244
+  CPU_COUNT(m, 000503, 05244);
+  COVERAGE_SET(m, 000503);
+  HISTORY_ADD(m, 000503, 05244, a, q);
+  cpma = 000444;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00504(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000504] != 07200 ||
+      m->mem[000505] != 03027 || m->breakpoints[000505] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00504  7200
+  CPU_COUNT(m, 000504, 07200);
+  COVERAGE_SET(m, 000504);
+  HISTORY_ADD(m, 000504, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00505  3027
+  CPU_COUNT(m, 000505, 03027);
+  COVERAGE_SET(m, 000505);
+  HISTORY_ADD(m, 000505, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000506;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00510(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000510] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00510  7200
+  CPU_COUNT(m, 000510, 07200);
+  COVERAGE_SET(m, 000510);
+  HISTORY_ADD(m, 000510, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000511;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00512(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000512] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00512  7450
+  CPU_COUNT(m, 000512, 07450);
+  COVERAGE_SET(m, 000512);
+  HISTORY_ADD(m, 000512, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000514 : 000513;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00513(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000513] != 05316 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00513  5316
+  CPU_COUNT(m, 000513, 05316);
+  COVERAGE_SET(m, 000513);
+  HISTORY_ADD(m, 000513, 05316, a, q);
+  cpma = 000516;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00514(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000514] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00514  7402
+  CPU_COUNT(m, 000514, 07402);
+  COVERAGE_SET(m, 000514);
+  HISTORY_ADD(m, 000514, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000516 : 000515;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00515(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000515] != 05306 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00515  5306
+  CPU_COUNT(m, 000515, 05306);
+  COVERAGE_SET(m, 000515);
+  HISTORY_ADD(m, 000515, 05306, a, q);
+  cpma = 000506;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00516(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000516] != 01064 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00516  1064
+  CPU_COUNT(m, 000516, 01064);
+  COVERAGE_SET(m, 000516);
+  HISTORY_ADD(m, 000516, 01064, a, q);
+  cpma = 000064;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000517;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00520(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000520] != 07040 ||
+      m->mem[000521] != 07450 || m->breakpoints[000521] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00520  7040
+  CPU_COUNT(m, 000520, 07040);
+  COVERAGE_SET(m, 000520);
+  HISTORY_ADD(m, 000520, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00521  7450
+  CPU_COUNT(m, 000521, 07450);
+  COVERAGE_SET(m, 000521);
+  HISTORY_ADD(m, 000521, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000523 : 000522;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00521(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000521] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00521  7450
+  CPU_COUNT(m, 000521, 07450);
+  COVERAGE_SET(m, 000521);
+  HISTORY_ADD(m, 000521, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000523 : 000522;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00522(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000522] != 05325 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00522  5325
+  CPU_COUNT(m, 000522, 05325);
+  COVERAGE_SET(m, 000522);
+  HISTORY_ADD(m, 000522, 05325, a, q);
+  cpma = 000525;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00523(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000523] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00523  7402
+  CPU_COUNT(m, 000523, 07402);
+  COVERAGE_SET(m, 000523);
+  HISTORY_ADD(m, 000523, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000525 : 000524;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00524(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000524] != 05306 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00524  5306
+  CPU_COUNT(m, 000524, 05306);
+  COVERAGE_SET(m, 000524);
+  HISTORY_ADD(m, 000524, 05306, a, q);
+  cpma = 000506;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00527(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[000527] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00527  7200
+  CPU_COUNT(m, 000527, 07200);
+  COVERAGE_SET(m, 000527);
+  HISTORY_ADD(m, 000527, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 000530;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00531(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000531] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00531  7450
+  CPU_COUNT(m, 000531, 07450);
+  COVERAGE_SET(m, 000531);
+  HISTORY_ADD(m, 000531, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000533 : 000532;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00532(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000532] != 05335 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00532  5335
+  CPU_COUNT(m, 000532, 05335);
+  COVERAGE_SET(m, 000532);
+  HISTORY_ADD(m, 000532, 05335, a, q);
+  cpma = 000535;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00533(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000533] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00533  7402
+  CPU_COUNT(m, 000533, 07402);
+  COVERAGE_SET(m, 000533);
+  HISTORY_ADD(m, 000533, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000535 : 000534;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00534(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000534] != 05325 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00534  5325
+  CPU_COUNT(m, 000534, 05325);
+  COVERAGE_SET(m, 000534);
+  HISTORY_ADD(m, 000534, 05325, a, q);
+  cpma = 000525;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00535(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000535] != 01110 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00535  1110
+  CPU_COUNT(m, 000535, 01110);
+  COVERAGE_SET(m, 000535);
+  HISTORY_ADD(m, 000535, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 000536;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00537(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000537] != 07040 ||
+      m->mem[000540] != 07450 || m->breakpoints[000540] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00537  7040
+  CPU_COUNT(m, 000537, 07040);
+  COVERAGE_SET(m, 000537);
+  HISTORY_ADD(m, 000537, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 00540  7450
+  CPU_COUNT(m, 000540, 07450);
+  COVERAGE_SET(m, 000540);
+  HISTORY_ADD(m, 000540, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000542 : 000541;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00540(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000540] != 07450 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00540  7450
+  CPU_COUNT(m, 000540, 07450);
+  COVERAGE_SET(m, 000540);
+  HISTORY_ADD(m, 000540, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 000542 : 000541;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00541(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000541] != 05344 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00541  5344
+  CPU_COUNT(m, 000541, 05344);
+  COVERAGE_SET(m, 000541);
+  HISTORY_ADD(m, 000541, 05344, a, q);
+  cpma = 000544;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00542(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000542] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00542  7402
+  CPU_COUNT(m, 000542, 07402);
+  COVERAGE_SET(m, 000542);
+  HISTORY_ADD(m, 000542, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000544 : 000543;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00543(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000543] != 05325 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00543  5325
+  CPU_COUNT(m, 000543, 05325);
+  COVERAGE_SET(m, 000543);
+  HISTORY_ADD(m, 000543, 05325, a, q);
+  cpma = 000525;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00544(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000544] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00544  2027
+  CPU_COUNT(m, 000544, 02027);
+  COVERAGE_SET(m, 000544);
+  HISTORY_ADD(m, 000544, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000546 : 000545;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00545(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000545] != 05306 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00545  5306
+  CPU_COUNT(m, 000545, 05306);
+  COVERAGE_SET(m, 000545);
+  HISTORY_ADD(m, 000545, 05306, a, q);
+  cpma = 000506;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00546(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000546] != 05747 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00546  5747
+  CPU_COUNT(m, 000546, 05747);
+  COVERAGE_SET(m, 000546);
+  HISTORY_ADD(m, 000546, 05747, a, q);
+  cpma = 000000 | (m->mem[000547] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b00600(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000600] != 03027 ||
+      m->mem[000601] != 04423 || m->breakpoints[000601] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00600  3027
+  CPU_COUNT(m, 000600, 03027);
+  COVERAGE_SET(m, 000600);
+  HISTORY_ADD(m, 000600, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000600 && cpma <= 000601 ){
+    m->ac = a; m->mq = q; m->pc = 000601; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 00601  4423
+  CPU_COUNT(m, 000601, 04423);
+  COVERAGE_SET(m, 000601);
+  HISTORY_ADD(m, 000601, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000602;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 2;
+  return res;
+}
+
+static int b00601(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000601] != 04423 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00601  4423
+  CPU_COUNT(m, 000601, 04423);
+  COVERAGE_SET(m, 000601);
+  HISTORY_ADD(m, 000601, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000602;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b00602(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000602] != 07001 ||
+      m->mem[000603] != 03030 || m->breakpoints[000603] ||
+      m->mem[000604] != 01040 || m->breakpoints[000604] ||
+      m->mem[000605] != 01045 || m->breakpoints[000605] ||
+      m->mem[000606] != 03207 || m->breakpoints[000606] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00602  7001
+  CPU_COUNT(m, 000602, 07001);
+  COVERAGE_SET(m, 000602);
+  HISTORY_ADD(m, 000602, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 00603  3030
+  CPU_COUNT(m, 000603, 03030);
+  COVERAGE_SET(m, 000603);
+  HISTORY_ADD(m, 000603, 03030, a, q);
+  cpma = 000030;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000602 && cpma <= 000606 ){
+    m->ac = a; m->mq = q; m->pc = 000604; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00604  1040
+  CPU_COUNT(m, 000604, 01040);
+  COVERAGE_SET(m, 000604);
+  HISTORY_ADD(m, 000604, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00605  1045
+  CPU_COUNT(m, 000605, 01045);
+  COVERAGE_SET(m, 000605);
+  HISTORY_ADD(m, 000605, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00606  3207
+  CPU_COUNT(m, 000606, 03207);
+  COVERAGE_SET(m, 000606);
+  HISTORY_ADD(m, 000606, 03207, a, q);
+  cpma = 000607;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000607;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b00610(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000610] != 01030 ||
+      m->mem[000611] != 03447 || m->breakpoints[000611] ||
+      m->mem[000612] != 02031 || m->breakpoints[000612] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 6400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00610  1030
+  CPU_COUNT(m, 000610, 01030);
+  COVERAGE_SET(m, 000610);
+  HISTORY_ADD(m, 000610, 01030, a, q);
+  cpma = 000030;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00611  3447
+  CPU_COUNT(m, 000611, 03447);
+  COVERAGE_SET(m, 000611);
+  HISTORY_ADD(m, 000611, 03447, a, q);
+  cpma = m->df_base | (m->mem[000047] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000610 && cpma <= 000612 ){
+    m->ac = a; m->mq = q; m->pc = 000612; *count = 2;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 00612  2031
+  CPU_COUNT(m, 000612, 02031);
+  COVERAGE_SET(m, 000612);
+  HISTORY_ADD(m, 000612, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000614 : 000613;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 9000;
+  *count = 3;
+  return res;
+}
+
+static int b00611(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000611] != 03447 ||
+      m->mem[000612] != 02031 || m->breakpoints[000612] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00611  3447
+  CPU_COUNT(m, 000611, 03447);
+  COVERAGE_SET(m, 000611);
+  HISTORY_ADD(m, 000611, 03447, a, q);
+  cpma = m->df_base | (m->mem[000047] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000611 && cpma <= 000612 ){
+    m->ac = a; m->mq = q; m->pc = 000612; *count = 1;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00612  2031
+  CPU_COUNT(m, 000612, 02031);
+  COVERAGE_SET(m, 000612);
+  HISTORY_ADD(m, 000612, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000614 : 000613;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 2;
+  return res;
+}
+
+static int b00613(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000613] != 07410 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00613  7410
+  CPU_COUNT(m, 000613, 07410);
+  COVERAGE_SET(m, 000613);
+  HISTORY_ADD(m, 000613, 07410, a, q);
+  cond = 0;
+  m->pc = ! cond ? 000615 : 000614;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00614(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000614] != 05222 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00614  5222
+  CPU_COUNT(m, 000614, 05222);
+  COVERAGE_SET(m, 000614);
+  HISTORY_ADD(m, 000614, 05222, a, q);
+  cpma = 000622;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00615(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000615] != 01045 ||
+      m->mem[000616] != 01207 || m->breakpoints[000616] ||
+      m->mem[000617] != 03207 || m->breakpoints[000617] ||
+      m->mem[000620] != 02030 || m->breakpoints[000620] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00615  1045
+  CPU_COUNT(m, 000615, 01045);
+  COVERAGE_SET(m, 000615);
+  HISTORY_ADD(m, 000615, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00616  1207
+  CPU_COUNT(m, 000616, 01207);
+  COVERAGE_SET(m, 000616);
+  HISTORY_ADD(m, 000616, 01207, a, q);
+  cpma = 000607;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00617  3207
+  CPU_COUNT(m, 000617, 03207);
+  COVERAGE_SET(m, 000617);
+  HISTORY_ADD(m, 000617, 03207, a, q);
+  cpma = 000607;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000615 && cpma <= 000620 ){
+    m->ac = a; m->mq = q; m->pc = 000620; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00620  2030
+  CPU_COUNT(m, 000620, 02030);
+  COVERAGE_SET(m, 000620);
+  HISTORY_ADD(m, 000620, 02030, a, q);
+  cpma = 000030;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000622 : 000621;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b00621(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000621] != 05207 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00621  5207
+  CPU_COUNT(m, 000621, 05207);
+  COVERAGE_SET(m, 000621);
+  HISTORY_ADD(m, 000621, 05207, a, q);
+  cpma = 000607;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00622(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000622] != 04423 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00622  4423
+  CPU_COUNT(m, 000622, 04423);
+  COVERAGE_SET(m, 000622);
+  HISTORY_ADD(m, 000622, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000623;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b00623(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000623] != 07001 ||
+      m->mem[000624] != 03030 || m->breakpoints[000624] ||
+      m->mem[000625] != 01040 || m->breakpoints[000625] ||
+      m->mem[000626] != 01045 || m->breakpoints[000626] ||
+      m->mem[000627] != 03230 || m->breakpoints[000627] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00623  7001
+  CPU_COUNT(m, 000623, 07001);
+  COVERAGE_SET(m, 000623);
+  HISTORY_ADD(m, 000623, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 00624  3030
+  CPU_COUNT(m, 000624, 03030);
+  COVERAGE_SET(m, 000624);
+  HISTORY_ADD(m, 000624, 03030, a, q);
+  cpma = 000030;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000623 && cpma <= 000627 ){
+    m->ac = a; m->mq = q; m->pc = 000625; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00625  1040
+  CPU_COUNT(m, 000625, 01040);
+  COVERAGE_SET(m, 000625);
+  HISTORY_ADD(m, 000625, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00626  1045
+  CPU_COUNT(m, 000626, 01045);
+  COVERAGE_SET(m, 000626);
+  HISTORY_ADD(m, 000626, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00627  3230
+  CPU_COUNT(m, 000627, 03230);
+  COVERAGE_SET(m, 000627);
+  HISTORY_ADD(m, 000627, 03230, a, q);
+  cpma = 000630;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000630;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b00631(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000631] != 01447 ||
+      m->mem[000632] != 03032 || m->breakpoints[000632] ||
+      m->mem[000633] != 01032 || m->breakpoints[000633] ||
+      m->mem[000634] != 07041 || m->breakpoints[000634] ||
+      m->mem[000635] != 01030 || m->breakpoints[000635] ||
+      m->mem[000636] != 07640 || m->breakpoints[000636] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 12800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00631  1447
+  CPU_COUNT(m, 000631, 01447);
+  COVERAGE_SET(m, 000631);
+  HISTORY_ADD(m, 000631, 01447, a, q);
+  cpma = m->df_base | (m->mem[000047] & B12_MASK);
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00632  3032
+  CPU_COUNT(m, 000632, 03032);
+  COVERAGE_SET(m, 000632);
+  HISTORY_ADD(m, 000632, 03032, a, q);
+  cpma = 000032;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000631 && cpma <= 000636 ){
+    m->ac = a; m->mq = q; m->pc = 000633; *count = 2;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 00633  1032
+  CPU_COUNT(m, 000633, 01032);
+  COVERAGE_SET(m, 000633);
+  HISTORY_ADD(m, 000633, 01032, a, q);
+  cpma = 000032;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00634  7041
+  CPU_COUNT(m, 000634, 07041);
+  COVERAGE_SET(m, 000634);
+  HISTORY_ADD(m, 000634, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 00635  1030
+  CPU_COUNT(m, 000635, 01030);
+  COVERAGE_SET(m, 000635);
+  HISTORY_ADD(m, 000635, 01030, a, q);
+  cpma = 000030;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00636  7640
+  CPU_COUNT(m, 000636, 07640);
+  COVERAGE_SET(m, 000636);
+  HISTORY_ADD(m, 000636, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 000640 : 000637;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 14000;
+  *count = 6;
+  return res;
+}
+
+static int b00632(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000632] != 03032 ||
+      m->mem[000633] != 01032 || m->breakpoints[000633] ||
+      m->mem[000634] != 07041 || m->breakpoints[000634] ||
+      m->mem[000635] != 01030 || m->breakpoints[000635] ||
+      m->mem[000636] != 07640 || m->breakpoints[000636] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00632  3032
+  CPU_COUNT(m, 000632, 03032);
+  COVERAGE_SET(m, 000632);
+  HISTORY_ADD(m, 000632, 03032, a, q);
+  cpma = 000032;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000632 && cpma <= 000636 ){
+    m->ac = a; m->mq = q; m->pc = 000633; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 00633  1032
+  CPU_COUNT(m, 000633, 01032);
+  COVERAGE_SET(m, 000633);
+  HISTORY_ADD(m, 000633, 01032, a, q);
+  cpma = 000032;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00634  7041
+  CPU_COUNT(m, 000634, 07041);
+  COVERAGE_SET(m, 000634);
+  HISTORY_ADD(m, 000634, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 00635  1030
+  CPU_COUNT(m, 000635, 01030);
+  COVERAGE_SET(m, 000635);
+  HISTORY_ADD(m, 000635, 01030, a, q);
+  cpma = 000030;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00636  7640
+  CPU_COUNT(m, 000636, 07640);
+  COVERAGE_SET(m, 000636);
+  HISTORY_ADD(m, 000636, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 000640 : 000637;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10200;
+  *count = 5;
+  return res;
+}
+
+static int b00637(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000637] != 05252 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00637  5252
+  CPU_COUNT(m, 000637, 05252);
+  COVERAGE_SET(m, 000637);
+  HISTORY_ADD(m, 000637, 05252, a, q);
+  cpma = 000652;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00640(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000640] != 02031 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00640  2031
+  CPU_COUNT(m, 000640, 02031);
+  COVERAGE_SET(m, 000640);
+  HISTORY_ADD(m, 000640, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000642 : 000641;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00641(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000641] != 05245 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00641  5245
+  CPU_COUNT(m, 000641, 05245);
+  COVERAGE_SET(m, 000641);
+  HISTORY_ADD(m, 000641, 05245, a, q);
+  cpma = 000645;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00642(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000642] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00642  2027
+  CPU_COUNT(m, 000642, 02027);
+  COVERAGE_SET(m, 000642);
+  HISTORY_ADD(m, 000642, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000644 : 000643;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00643(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000643] != 05201 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00643  5201
+  CPU_COUNT(m, 000643, 05201);
+  COVERAGE_SET(m, 000643);
+  HISTORY_ADD(m, 000643, 05201, a, q);
+  cpma = 000601;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00644(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000644] != 05256 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00644  5256
+  CPU_COUNT(m, 000644, 05256);
+  COVERAGE_SET(m, 000644);
+  HISTORY_ADD(m, 000644, 05256, a, q);
+  cpma = 000656;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00645(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000645] != 01045 ||
+      m->mem[000646] != 01230 || m->breakpoints[000646] ||
+      m->mem[000647] != 03230 || m->breakpoints[000647] ||
+      m->mem[000650] != 02030 || m->breakpoints[000650] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00645  1045
+  CPU_COUNT(m, 000645, 01045);
+  COVERAGE_SET(m, 000645);
+  HISTORY_ADD(m, 000645, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00646  1230
+  CPU_COUNT(m, 000646, 01230);
+  COVERAGE_SET(m, 000646);
+  HISTORY_ADD(m, 000646, 01230, a, q);
+  cpma = 000630;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00647  3230
+  CPU_COUNT(m, 000647, 03230);
+  COVERAGE_SET(m, 000647);
+  HISTORY_ADD(m, 000647, 03230, a, q);
+  cpma = 000630;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000645 && cpma <= 000650 ){
+    m->ac = a; m->mq = q; m->pc = 000650; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00650  2030
+  CPU_COUNT(m, 000650, 02030);
+  COVERAGE_SET(m, 000650);
+  HISTORY_ADD(m, 000650, 02030, a, q);
+  cpma = 000030;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000652 : 000651;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b00651(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000651] != 05230 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00651  5230
+  CPU_COUNT(m, 000651, 05230);
+  COVERAGE_SET(m, 000651);
+  HISTORY_ADD(m, 000651, 05230, a, q);
+  cpma = 000630;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00652(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000652] != 01032 ||
+      m->mem[000653] != 07402 || m->breakpoints[000653] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00652  1032
+  CPU_COUNT(m, 000652, 01032);
+  COVERAGE_SET(m, 000652);
+  HISTORY_ADD(m, 000652, 01032, a, q);
+  cpma = 000032;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00653  7402
+  CPU_COUNT(m, 000653, 07402);
+  COVERAGE_SET(m, 000653);
+  HISTORY_ADD(m, 000653, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000655 : 000654;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00654(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000654] != 07200 ||
+      m->mem[000655] != 05230 || m->breakpoints[000655] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00654  7200
+  CPU_COUNT(m, 000654, 07200);
+  COVERAGE_SET(m, 000654);
+  HISTORY_ADD(m, 000654, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00655  5230
+  CPU_COUNT(m, 000655, 05230);
+  COVERAGE_SET(m, 000655);
+  HISTORY_ADD(m, 000655, 05230, a, q);
+  cpma = 000630;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00655(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000655] != 05230 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00655  5230
+  CPU_COUNT(m, 000655, 05230);
+  COVERAGE_SET(m, 000655);
+  HISTORY_ADD(m, 000655, 05230, a, q);
+  cpma = 000630;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00657(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000657] != 01021 ||
+      m->mem[000660] != 03001 || m->breakpoints[000660] ||
+      m->mem[000661] != 01352 || m->breakpoints[000661] ||
+      m->mem[000662] != 03002 || m->breakpoints[000662] ||
+      m->mem[000663] != 01020 || m->breakpoints[000663] ||
+      m->mem[000664] != 03003 || m->breakpoints[000664] ||
+      m->mem[000665] != 04423 || m->breakpoints[000665] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 7 || m->time + 15600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00657  1021
+  CPU_COUNT(m, 000657, 01021);
+  COVERAGE_SET(m, 000657);
+  HISTORY_ADD(m, 000657, 01021, a, q);
+  cpma = 000021;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00660  3001
+  CPU_COUNT(m, 000660, 03001);
+  COVERAGE_SET(m, 000660);
+  HISTORY_ADD(m, 000660, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000657 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000661; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 00661  1352
+  CPU_COUNT(m, 000661, 01352);
+  COVERAGE_SET(m, 000661);
+  HISTORY_ADD(m, 000661, 01352, a, q);
+  cpma = 000752;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00662  3002
+  CPU_COUNT(m, 000662, 03002);
+  COVERAGE_SET(m, 000662);
+  HISTORY_ADD(m, 000662, 03002, a, q);
+  cpma = 000002;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000657 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000663; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 00663  1020
+  CPU_COUNT(m, 000663, 01020);
+  COVERAGE_SET(m, 000663);
+  HISTORY_ADD(m, 000663, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00664  3003
+  CPU_COUNT(m, 000664, 03003);
+  COVERAGE_SET(m, 000664);
+  HISTORY_ADD(m, 000664, 03003, a, q);
+  cpma = 000003;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000657 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000665; *count = 6;
+    m->time += 15600;
+    return 0;
+  }
+
+  // 00665  4423
+  CPU_COUNT(m, 000665, 04423);
+  COVERAGE_SET(m, 000665);
+  HISTORY_ADD(m, 000665, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000666;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 19400;
+  *count = 7;
+  return res;
+}
+
+static int b00660(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000660] != 03001 ||
+      m->mem[000661] != 01352 || m->breakpoints[000661] ||
+      m->mem[000662] != 03002 || m->breakpoints[000662] ||
+      m->mem[000663] != 01020 || m->breakpoints[000663] ||
+      m->mem[000664] != 03003 || m->breakpoints[000664] ||
+      m->mem[000665] != 04423 || m->breakpoints[000665] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 13000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00660  3001
+  CPU_COUNT(m, 000660, 03001);
+  COVERAGE_SET(m, 000660);
+  HISTORY_ADD(m, 000660, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000660 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000661; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 00661  1352
+  CPU_COUNT(m, 000661, 01352);
+  COVERAGE_SET(m, 000661);
+  HISTORY_ADD(m, 000661, 01352, a, q);
+  cpma = 000752;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00662  3002
+  CPU_COUNT(m, 000662, 03002);
+  COVERAGE_SET(m, 000662);
+  HISTORY_ADD(m, 000662, 03002, a, q);
+  cpma = 000002;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000660 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000663; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00663  1020
+  CPU_COUNT(m, 000663, 01020);
+  COVERAGE_SET(m, 000663);
+  HISTORY_ADD(m, 000663, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00664  3003
+  CPU_COUNT(m, 000664, 03003);
+  COVERAGE_SET(m, 000664);
+  HISTORY_ADD(m, 000664, 03003, a, q);
+  cpma = 000003;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000660 && cpma <= 000665 ){
+    m->ac = a; m->mq = q; m->pc = 000665; *count = 5;
+    m->time += 13000;
+    return 0;
+  }
+
+  // 00665  4423
+  CPU_COUNT(m, 000665, 04423);
+  COVERAGE_SET(m, 000665);
+  HISTORY_ADD(m, 000665, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000666;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 16800;
+  *count = 6;
+  return res;
+}
+
+static int b00666(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000666] != 01040 ||
+      m->mem[000667] != 01045 || m->breakpoints[000667] ||
+      m->mem[000670] != 03271 || m->breakpoints[000670] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 5200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00666  1040
+  CPU_COUNT(m, 000666, 01040);
+  COVERAGE_SET(m, 000666);
+  HISTORY_ADD(m, 000666, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00667  1045
+  CPU_COUNT(m, 000667, 01045);
+  COVERAGE_SET(m, 000667);
+  HISTORY_ADD(m, 000667, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00670  3271
+  CPU_COUNT(m, 000670, 03271);
+  COVERAGE_SET(m, 000670);
+  HISTORY_ADD(m, 000670, 03271, a, q);
+  cpma = 000671;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000671;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 7800;
+  *count = 3;
+  return res;
+}
+
+static int b00667(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000667] != 01045 ||
+      m->mem[000670] != 03271 || m->breakpoints[000670] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00667  1045
+  CPU_COUNT(m, 000667, 01045);
+  COVERAGE_SET(m, 000667);
+  HISTORY_ADD(m, 000667, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00670  3271
+  CPU_COUNT(m, 000670, 03271);
+  COVERAGE_SET(m, 000670);
+  HISTORY_ADD(m, 000670, 03271, a, q);
+  cpma = 000671;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000671;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5200;
+  *count = 2;
+  return res;
+}
+
+static int b00672(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000672] != 01037 ||
+      m->mem[000673] != 03443 || m->breakpoints[000673] ||
+      m->mem[000674] != 01037 || m->breakpoints[000674] ||
+      m->mem[000675] != 03754 || m->breakpoints[000675] ||
+      m->mem[000676] != 01037 || m->breakpoints[000676] ||
+      m->mem[000677] != 03755 || m->breakpoints[000677] ||
+      m->mem[000700] != 02031 || m->breakpoints[000700] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 7 || m->time + 19200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00672  1037
+  CPU_COUNT(m, 000672, 01037);
+  COVERAGE_SET(m, 000672);
+  HISTORY_ADD(m, 000672, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00673  3443
+  CPU_COUNT(m, 000673, 03443);
+  COVERAGE_SET(m, 000673);
+  HISTORY_ADD(m, 000673, 03443, a, q);
+  cpma = m->df_base | (m->mem[000043] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000672 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000674; *count = 2;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 00674  1037
+  CPU_COUNT(m, 000674, 01037);
+  COVERAGE_SET(m, 000674);
+  HISTORY_ADD(m, 000674, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00675  3754
+  CPU_COUNT(m, 000675, 03754);
+  COVERAGE_SET(m, 000675);
+  HISTORY_ADD(m, 000675, 03754, a, q);
+  cpma = m->df_base | (m->mem[000754] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000672 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000676; *count = 4;
+    m->time += 12800;
+    return 0;
+  }
+
+  // 00676  1037
+  CPU_COUNT(m, 000676, 01037);
+  COVERAGE_SET(m, 000676);
+  HISTORY_ADD(m, 000676, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00677  3755
+  CPU_COUNT(m, 000677, 03755);
+  COVERAGE_SET(m, 000677);
+  HISTORY_ADD(m, 000677, 03755, a, q);
+  cpma = m->df_base | (m->mem[000755] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000672 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000700; *count = 6;
+    m->time += 19200;
+    return 0;
+  }
+
+  // 00700  2031
+  CPU_COUNT(m, 000700, 02031);
+  COVERAGE_SET(m, 000700);
+  HISTORY_ADD(m, 000700, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000702 : 000701;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 21800;
+  *count = 7;
+  return res;
+}
+
+static int b00673(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000673] != 03443 ||
+      m->mem[000674] != 01037 || m->breakpoints[000674] ||
+      m->mem[000675] != 03754 || m->breakpoints[000675] ||
+      m->mem[000676] != 01037 || m->breakpoints[000676] ||
+      m->mem[000677] != 03755 || m->breakpoints[000677] ||
+      m->mem[000700] != 02031 || m->breakpoints[000700] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 16600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00673  3443
+  CPU_COUNT(m, 000673, 03443);
+  COVERAGE_SET(m, 000673);
+  HISTORY_ADD(m, 000673, 03443, a, q);
+  cpma = m->df_base | (m->mem[000043] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000673 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000674; *count = 1;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 00674  1037
+  CPU_COUNT(m, 000674, 01037);
+  COVERAGE_SET(m, 000674);
+  HISTORY_ADD(m, 000674, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00675  3754
+  CPU_COUNT(m, 000675, 03754);
+  COVERAGE_SET(m, 000675);
+  HISTORY_ADD(m, 000675, 03754, a, q);
+  cpma = m->df_base | (m->mem[000754] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000673 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000676; *count = 3;
+    m->time += 10200;
+    return 0;
+  }
+
+  // 00676  1037
+  CPU_COUNT(m, 000676, 01037);
+  COVERAGE_SET(m, 000676);
+  HISTORY_ADD(m, 000676, 01037, a, q);
+  cpma = 000037;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00677  3755
+  CPU_COUNT(m, 000677, 03755);
+  COVERAGE_SET(m, 000677);
+  HISTORY_ADD(m, 000677, 03755, a, q);
+  cpma = m->df_base | (m->mem[000755] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000673 && cpma <= 000700 ){
+    m->ac = a; m->mq = q; m->pc = 000700; *count = 5;
+    m->time += 16600;
+    return 0;
+  }
+
+  // 00700  2031
+  CPU_COUNT(m, 000700, 02031);
+  COVERAGE_SET(m, 000700);
+  HISTORY_ADD(m, 000700, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000702 : 000701;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 19200;
+  *count = 6;
+  return res;
+}
+
+static int b00701(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000701] != 07410 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00701  7410
+  CPU_COUNT(m, 000701, 07410);
+  COVERAGE_SET(m, 000701);
+  HISTORY_ADD(m, 000701, 07410, a, q);
+  cond = 0;
+  m->pc = ! cond ? 000703 : 000702;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00702(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000702] != 05305 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00702  5305
+  CPU_COUNT(m, 000702, 05305);
+  COVERAGE_SET(m, 000702);
+  HISTORY_ADD(m, 000702, 05305, a, q);
+  cpma = 000705;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00703(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000703] != 01271 ||
+      m->mem[000704] != 05267 || m->breakpoints[000704] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00703  1271
+  CPU_COUNT(m, 000703, 01271);
+  COVERAGE_SET(m, 000703);
+  HISTORY_ADD(m, 000703, 01271, a, q);
+  cpma = 000671;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00704  5267
+  CPU_COUNT(m, 000704, 05267);
+  COVERAGE_SET(m, 000704);
+  HISTORY_ADD(m, 000704, 05267, a, q);
+  cpma = 000667;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00707(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000707] != 04422 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00707  4422
+  CPU_COUNT(m, 000707, 04422);
+  COVERAGE_SET(m, 000707);
+  HISTORY_ADD(m, 000707, 04422, a, q);
+  cpma = 000000 | (m->mem[000022] & B12_MASK);
+  m->pc = 000710;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b00710(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000710] != 03027 ||
+      m->mem[000711] != 01041 || m->breakpoints[000711] ||
+      m->mem[000712] != 03323 || m->breakpoints[000712] ||
+      m->mem[000713] != 03353 || m->breakpoints[000713] ||
+      m->mem[000714] != 04423 || m->breakpoints[000714] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 10400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00710  3027
+  CPU_COUNT(m, 000710, 03027);
+  COVERAGE_SET(m, 000710);
+  HISTORY_ADD(m, 000710, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000710 && cpma <= 000714 ){
+    m->ac = a; m->mq = q; m->pc = 000711; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 00711  1041
+  CPU_COUNT(m, 000711, 01041);
+  COVERAGE_SET(m, 000711);
+  HISTORY_ADD(m, 000711, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00712  3323
+  CPU_COUNT(m, 000712, 03323);
+  COVERAGE_SET(m, 000712);
+  HISTORY_ADD(m, 000712, 03323, a, q);
+  cpma = 000723;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000710 && cpma <= 000714 ){
+    m->ac = a; m->mq = q; m->pc = 000713; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00713  3353
+  CPU_COUNT(m, 000713, 03353);
+  COVERAGE_SET(m, 000713);
+  HISTORY_ADD(m, 000713, 03353, a, q);
+  cpma = 000753;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000710 && cpma <= 000714 ){
+    m->ac = a; m->mq = q; m->pc = 000714; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 00714  4423
+  CPU_COUNT(m, 000714, 04423);
+  COVERAGE_SET(m, 000714);
+  HISTORY_ADD(m, 000714, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000715;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 14200;
+  *count = 5;
+  return res;
+}
+
+static int b00711(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000711] != 01041 ||
+      m->mem[000712] != 03323 || m->breakpoints[000712] ||
+      m->mem[000713] != 03353 || m->breakpoints[000713] ||
+      m->mem[000714] != 04423 || m->breakpoints[000714] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00711  1041
+  CPU_COUNT(m, 000711, 01041);
+  COVERAGE_SET(m, 000711);
+  HISTORY_ADD(m, 000711, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00712  3323
+  CPU_COUNT(m, 000712, 03323);
+  COVERAGE_SET(m, 000712);
+  HISTORY_ADD(m, 000712, 03323, a, q);
+  cpma = 000723;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000711 && cpma <= 000714 ){
+    m->ac = a; m->mq = q; m->pc = 000713; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 00713  3353
+  CPU_COUNT(m, 000713, 03353);
+  COVERAGE_SET(m, 000713);
+  HISTORY_ADD(m, 000713, 03353, a, q);
+  cpma = 000753;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000711 && cpma <= 000714 ){
+    m->ac = a; m->mq = q; m->pc = 000714; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00714  4423
+  CPU_COUNT(m, 000714, 04423);
+  COVERAGE_SET(m, 000714);
+  HISTORY_ADD(m, 000714, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 000715;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 4;
+  return res;
+}
+
+static int b00715(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000715] != 01323 ||
+      m->mem[000716] != 01045 || m->breakpoints[000716] ||
+      m->mem[000717] != 03323 || m->breakpoints[000717] ||
+      m->mem[000720] != 01353 || m->breakpoints[000720] ||
+      m->mem[000721] != 01045 || m->breakpoints[000721] ||
+      m->mem[000722] != 03353 || m->breakpoints[000722] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 13000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00715  1323
+  CPU_COUNT(m, 000715, 01323);
+  COVERAGE_SET(m, 000715);
+  HISTORY_ADD(m, 000715, 01323, a, q);
+  cpma = 000723;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00716  1045
+  CPU_COUNT(m, 000716, 01045);
+  COVERAGE_SET(m, 000716);
+  HISTORY_ADD(m, 000716, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00717  3323
+  CPU_COUNT(m, 000717, 03323);
+  COVERAGE_SET(m, 000717);
+  HISTORY_ADD(m, 000717, 03323, a, q);
+  cpma = 000723;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 000715 && cpma <= 000722 ){
+    m->ac = a; m->mq = q; m->pc = 000720; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 00720  1353
+  CPU_COUNT(m, 000720, 01353);
+  COVERAGE_SET(m, 000720);
+  HISTORY_ADD(m, 000720, 01353, a, q);
+  cpma = 000753;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00721  1045
+  CPU_COUNT(m, 000721, 01045);
+  COVERAGE_SET(m, 000721);
+  HISTORY_ADD(m, 000721, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00722  3353
+  CPU_COUNT(m, 000722, 03353);
+  COVERAGE_SET(m, 000722);
+  HISTORY_ADD(m, 000722, 03353, a, q);
+  cpma = 000753;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 000723;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 15600;
+  *count = 6;
+  return res;
+}
+
+static int b00725(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000725] != 07000 ||
+      m->mem[000726] != 05327 || m->breakpoints[000726] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00725  7000
+  CPU_COUNT(m, 000725, 07000);
+  COVERAGE_SET(m, 000725);
+  HISTORY_ADD(m, 000725, 07000, a, q);
+
+  // 00726  5327
+  CPU_COUNT(m, 000726, 05327);
+  COVERAGE_SET(m, 000726);
+  HISTORY_ADD(m, 000726, 05327, a, q);
+  cpma = 000727;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00726(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000726] != 05327 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00726  5327
+  CPU_COUNT(m, 000726, 05327);
+  COVERAGE_SET(m, 000726);
+  HISTORY_ADD(m, 000726, 05327, a, q);
+  cpma = 000727;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00727(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000727] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00727  7402
+  CPU_COUNT(m, 000727, 07402);
+  COVERAGE_SET(m, 000727);
+  HISTORY_ADD(m, 000727, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000731 : 000730;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00731(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000731] != 07041 ||
+      m->mem[000732] != 01353 || m->breakpoints[000732] ||
+      m->mem[000733] != 07650 || m->breakpoints[000733] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00731  7041
+  CPU_COUNT(m, 000731, 07041);
+  COVERAGE_SET(m, 000731);
+  HISTORY_ADD(m, 000731, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 00732  1353
+  CPU_COUNT(m, 000732, 01353);
+  COVERAGE_SET(m, 000732);
+  HISTORY_ADD(m, 000732, 01353, a, q);
+  cpma = 000753;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00733  7650
+  CPU_COUNT(m, 000733, 07650);
+  COVERAGE_SET(m, 000733);
+  HISTORY_ADD(m, 000733, 07650, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = ! cond ? 000735 : 000734;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b00732(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000732] != 01353 ||
+      m->mem[000733] != 07650 || m->breakpoints[000733] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00732  1353
+  CPU_COUNT(m, 000732, 01353);
+  COVERAGE_SET(m, 000732);
+  HISTORY_ADD(m, 000732, 01353, a, q);
+  cpma = 000753;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00733  7650
+  CPU_COUNT(m, 000733, 07650);
+  COVERAGE_SET(m, 000733);
+  HISTORY_ADD(m, 000733, 07650, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = ! cond ? 000735 : 000734;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b00734(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000734] != 05344 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00734  5344
+  CPU_COUNT(m, 000734, 05344);
+  COVERAGE_SET(m, 000734);
+  HISTORY_ADD(m, 000734, 05344, a, q);
+  cpma = 000744;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00735(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000735] != 01353 ||
+      m->mem[000736] != 07421 || m->breakpoints[000736] ||
+      m->mem[000737] != 07300 || m->breakpoints[000737] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00735  1353
+  CPU_COUNT(m, 000735, 01353);
+  COVERAGE_SET(m, 000735);
+  HISTORY_ADD(m, 000735, 01353, a, q);
+  cpma = 000753;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 00736  7421
+  CPU_COUNT(m, 000736, 07421);
+  COVERAGE_SET(m, 000736);
+  HISTORY_ADD(m, 000736, 07421, a, q);
+  q = a & AC_MASK;
+  a &= LINK_MASK;
+
+  // 00737  7300
+  CPU_COUNT(m, 000737, 07300);
+  COVERAGE_SET(m, 000737);
+  HISTORY_ADD(m, 000737, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  m->pc = 000740;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b00741(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[000741] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00741  7402
+  CPU_COUNT(m, 000741, 07402);
+  COVERAGE_SET(m, 000741);
+  HISTORY_ADD(m, 000741, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 000743 : 000742;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00742(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000742] != 07200 ||
+      m->mem[000743] != 05323 || m->breakpoints[000743] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00742  7200
+  CPU_COUNT(m, 000742, 07200);
+  COVERAGE_SET(m, 000742);
+  HISTORY_ADD(m, 000742, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 00743  5323
+  CPU_COUNT(m, 000743, 05323);
+  COVERAGE_SET(m, 000743);
+  HISTORY_ADD(m, 000743, 05323, a, q);
+  cpma = 000723;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b00743(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000743] != 05323 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00743  5323
+  CPU_COUNT(m, 000743, 05323);
+  COVERAGE_SET(m, 000743);
+  HISTORY_ADD(m, 000743, 05323, a, q);
+  cpma = 000723;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00744(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000744] != 02031 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00744  2031
+  CPU_COUNT(m, 000744, 02031);
+  COVERAGE_SET(m, 000744);
+  HISTORY_ADD(m, 000744, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000746 : 000745;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00745(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000745] != 05315 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00745  5315
+  CPU_COUNT(m, 000745, 05315);
+  COVERAGE_SET(m, 000745);
+  HISTORY_ADD(m, 000745, 05315, a, q);
+  cpma = 000715;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00746(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000746] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00746  2027
+  CPU_COUNT(m, 000746, 02027);
+  COVERAGE_SET(m, 000746);
+  HISTORY_ADD(m, 000746, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 000750 : 000747;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b00747(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000747] != 05311 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00747  5311
+  CPU_COUNT(m, 000747, 05311);
+  COVERAGE_SET(m, 000747);
+  HISTORY_ADD(m, 000747, 05311, a, q);
+  cpma = 000711;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b00750(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[000750] != 05751 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 00750  5751
+  CPU_COUNT(m, 000750, 05751);
+  COVERAGE_SET(m, 000750);
+  HISTORY_ADD(m, 000750, 05751, a, q);
+  cpma = 000000 | (m->mem[000751] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b01000(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[001000] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01000  7200
+  CPU_COUNT(m, 001000, 07200);
+  COVERAGE_SET(m, 001000);
+  HISTORY_ADD(m, 001000, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 001001;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01003(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001003] != 04422 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01003  4422
+  CPU_COUNT(m, 001003, 04422);
+  COVERAGE_SET(m, 001003);
+  HISTORY_ADD(m, 001003, 04422, a, q);
+  cpma = 000000 | (m->mem[000022] & B12_MASK);
+  m->pc = 001004;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b01004(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001004] != 03027 ||
+      m->mem[001005] != 01041 || m->breakpoints[001005] ||
+      m->mem[001006] != 03217 || m->breakpoints[001006] ||
+      m->mem[001007] != 03246 || m->breakpoints[001007] ||
+      m->mem[001010] != 04423 || m->breakpoints[001010] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 10400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01004  3027
+  CPU_COUNT(m, 001004, 03027);
+  COVERAGE_SET(m, 001004);
+  HISTORY_ADD(m, 001004, 03027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001004 && cpma <= 001010 ){
+    m->ac = a; m->mq = q; m->pc = 001005; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 01005  1041
+  CPU_COUNT(m, 001005, 01041);
+  COVERAGE_SET(m, 001005);
+  HISTORY_ADD(m, 001005, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01006  3217
+  CPU_COUNT(m, 001006, 03217);
+  COVERAGE_SET(m, 001006);
+  HISTORY_ADD(m, 001006, 03217, a, q);
+  cpma = 001017;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001004 && cpma <= 001010 ){
+    m->ac = a; m->mq = q; m->pc = 001007; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 01007  3246
+  CPU_COUNT(m, 001007, 03246);
+  COVERAGE_SET(m, 001007);
+  HISTORY_ADD(m, 001007, 03246, a, q);
+  cpma = 001046;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001004 && cpma <= 001010 ){
+    m->ac = a; m->mq = q; m->pc = 001010; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 01010  4423
+  CPU_COUNT(m, 001010, 04423);
+  COVERAGE_SET(m, 001010);
+  HISTORY_ADD(m, 001010, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 001011;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 14200;
+  *count = 5;
+  return res;
+}
+
+static int b01005(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001005] != 01041 ||
+      m->mem[001006] != 03217 || m->breakpoints[001006] ||
+      m->mem[001007] != 03246 || m->breakpoints[001007] ||
+      m->mem[001010] != 04423 || m->breakpoints[001010] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01005  1041
+  CPU_COUNT(m, 001005, 01041);
+  COVERAGE_SET(m, 001005);
+  HISTORY_ADD(m, 001005, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01006  3217
+  CPU_COUNT(m, 001006, 03217);
+  COVERAGE_SET(m, 001006);
+  HISTORY_ADD(m, 001006, 03217, a, q);
+  cpma = 001017;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001005 && cpma <= 001010 ){
+    m->ac = a; m->mq = q; m->pc = 001007; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 01007  3246
+  CPU_COUNT(m, 001007, 03246);
+  COVERAGE_SET(m, 001007);
+  HISTORY_ADD(m, 001007, 03246, a, q);
+  cpma = 001046;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001005 && cpma <= 001010 ){
+    m->ac = a; m->mq = q; m->pc = 001010; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 01010  4423
+  CPU_COUNT(m, 001010, 04423);
+  COVERAGE_SET(m, 001010);
+  HISTORY_ADD(m, 001010, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 001011;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 4;
+  return res;
+}
+
+static int b01011(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001011] != 01217 ||
+      m->mem[001012] != 01045 || m->breakpoints[001012] ||
+      m->mem[001013] != 03217 || m->breakpoints[001013] ||
+      m->mem[001014] != 01246 || m->breakpoints[001014] ||
+      m->mem[001015] != 01045 || m->breakpoints[001015] ||
+      m->mem[001016] != 03246 || m->breakpoints[001016] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 13000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01011  1217
+  CPU_COUNT(m, 001011, 01217);
+  COVERAGE_SET(m, 001011);
+  HISTORY_ADD(m, 001011, 01217, a, q);
+  cpma = 001017;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01012  1045
+  CPU_COUNT(m, 001012, 01045);
+  COVERAGE_SET(m, 001012);
+  HISTORY_ADD(m, 001012, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01013  3217
+  CPU_COUNT(m, 001013, 03217);
+  COVERAGE_SET(m, 001013);
+  HISTORY_ADD(m, 001013, 03217, a, q);
+  cpma = 001017;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 001011 && cpma <= 001016 ){
+    m->ac = a; m->mq = q; m->pc = 001014; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 01014  1246
+  CPU_COUNT(m, 001014, 01246);
+  COVERAGE_SET(m, 001014);
+  HISTORY_ADD(m, 001014, 01246, a, q);
+  cpma = 001046;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01015  1045
+  CPU_COUNT(m, 001015, 01045);
+  COVERAGE_SET(m, 001015);
+  HISTORY_ADD(m, 001015, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01016  3246
+  CPU_COUNT(m, 001016, 03246);
+  COVERAGE_SET(m, 001016);
+  HISTORY_ADD(m, 001016, 03246, a, q);
+  cpma = 001046;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 001017;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 15600;
+  *count = 6;
+  return res;
+}
+
+static int b01021(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001021] != 07000 ||
+      m->mem[001022] != 04223 || m->breakpoints[001022] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01021  7000
+  CPU_COUNT(m, 001021, 07000);
+  COVERAGE_SET(m, 001021);
+  HISTORY_ADD(m, 001021, 07000, a, q);
+
+  // 01022  4223
+  CPU_COUNT(m, 001022, 04223);
+  COVERAGE_SET(m, 001022);
+  HISTORY_ADD(m, 001022, 04223, a, q);
+  cpma = 001023;
+  m->pc = 001023;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b01022(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001022] != 04223 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01022  4223
+  CPU_COUNT(m, 001022, 04223);
+  COVERAGE_SET(m, 001022);
+  HISTORY_ADD(m, 001022, 04223, a, q);
+  cpma = 001023;
+  m->pc = 001023;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b01023(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[001023] != 00000 ||
+      m->mem[001024] != 07402 || m->breakpoints[001024] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01023  0000
+  CPU_COUNT(m, 001023, 00000);
+  COVERAGE_SET(m, 001023);
+  HISTORY_ADD(m, 001023, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 01024  7402
+  CPU_COUNT(m, 001024, 07402);
+  COVERAGE_SET(m, 001024);
+  HISTORY_ADD(m, 001024, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 001026 : 001025;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b01024(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[001024] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01024  7402
+  CPU_COUNT(m, 001024, 07402);
+  COVERAGE_SET(m, 001024);
+  HISTORY_ADD(m, 001024, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 001026 : 001025;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01026(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[001026] != 07041 ||
+      m->mem[001027] != 01246 || m->breakpoints[001027] ||
+      m->mem[001030] != 07650 || m->breakpoints[001030] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01026  7041
+  CPU_COUNT(m, 001026, 07041);
+  COVERAGE_SET(m, 001026);
+  HISTORY_ADD(m, 001026, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 01027  1246
+  CPU_COUNT(m, 001027, 01246);
+  COVERAGE_SET(m, 001027);
+  HISTORY_ADD(m, 001027, 01246, a, q);
+  cpma = 001046;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01030  7650
+  CPU_COUNT(m, 001030, 07650);
+  COVERAGE_SET(m, 001030);
+  HISTORY_ADD(m, 001030, 07650, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = ! cond ? 001032 : 001031;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b01027(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[001027] != 01246 ||
+      m->mem[001030] != 07650 || m->breakpoints[001030] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01027  1246
+  CPU_COUNT(m, 001027, 01246);
+  COVERAGE_SET(m, 001027);
+  HISTORY_ADD(m, 001027, 01246, a, q);
+  cpma = 001046;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01030  7650
+  CPU_COUNT(m, 001030, 07650);
+  COVERAGE_SET(m, 001030);
+  HISTORY_ADD(m, 001030, 07650, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = ! cond ? 001032 : 001031;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b01031(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001031] != 05241 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01031  5241
+  CPU_COUNT(m, 001031, 05241);
+  COVERAGE_SET(m, 001031);
+  HISTORY_ADD(m, 001031, 05241, a, q);
+  cpma = 001041;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01032(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001032] != 01246 ||
+      m->mem[001033] != 07110 || m->breakpoints[001033] ||
+      m->mem[001034] != 07012 || m->breakpoints[001034] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01032  1246
+  CPU_COUNT(m, 001032, 01246);
+  COVERAGE_SET(m, 001032);
+  HISTORY_ADD(m, 001032, 01246, a, q);
+  cpma = 001046;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 01033  7110
+  CPU_COUNT(m, 001033, 07110);
+  COVERAGE_SET(m, 001033);
+  HISTORY_ADD(m, 001033, 07110, a, q);
+  a &= AC_MASK;
+  a = (a >> 1) | ((a & 1) << 12);
+
+  // 01034  7012
+  CPU_COUNT(m, 001034, 07012);
+  COVERAGE_SET(m, 001034);
+  HISTORY_ADD(m, 001034, 07012, a, q);
+  a = (a >> 1) | ((a & 1) << 12);
+  a = (a >> 1) | ((a & 1) << 12);
+  m->pc = 001035;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b01036(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[001036] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01036  7402
+  CPU_COUNT(m, 001036, 07402);
+  COVERAGE_SET(m, 001036);
+  HISTORY_ADD(m, 001036, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 001040 : 001037;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01037(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001037] != 07200 ||
+      m->mem[001040] != 05217 || m->breakpoints[001040] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01037  7200
+  CPU_COUNT(m, 001037, 07200);
+  COVERAGE_SET(m, 001037);
+  HISTORY_ADD(m, 001037, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 01040  5217
+  CPU_COUNT(m, 001040, 05217);
+  COVERAGE_SET(m, 001040);
+  HISTORY_ADD(m, 001040, 05217, a, q);
+  cpma = 001017;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 2;
+  return res;
+}
+
+static int b01040(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001040] != 05217 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01040  5217
+  CPU_COUNT(m, 001040, 05217);
+  COVERAGE_SET(m, 001040);
+  HISTORY_ADD(m, 001040, 05217, a, q);
+  cpma = 001017;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01041(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001041] != 02031 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01041  2031
+  CPU_COUNT(m, 001041, 02031);
+  COVERAGE_SET(m, 001041);
+  HISTORY_ADD(m, 001041, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 001043 : 001042;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b01042(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001042] != 05211 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01042  5211
+  CPU_COUNT(m, 001042, 05211);
+  COVERAGE_SET(m, 001042);
+  HISTORY_ADD(m, 001042, 05211, a, q);
+  cpma = 001011;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01043(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001043] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01043  2027
+  CPU_COUNT(m, 001043, 02027);
+  COVERAGE_SET(m, 001043);
+  HISTORY_ADD(m, 001043, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 001045 : 001044;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b01044(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001044] != 05205 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01044  5205
+  CPU_COUNT(m, 001044, 05205);
+  COVERAGE_SET(m, 001044);
+  HISTORY_ADD(m, 001044, 05205, a, q);
+  cpma = 001005;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b01045(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[001045] != 05647 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 01045  5647
+  CPU_COUNT(m, 001045, 05647);
+  COVERAGE_SET(m, 001045);
+  HISTORY_ADD(m, 001045, 05647, a, q);
+  cpma = 000000 | (m->mem[001047] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b02050(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002050] != 07300 ||
+      m->mem[002051] != 04423 || m->breakpoints[002051] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02050  7300
+  CPU_COUNT(m, 002050, 07300);
+  COVERAGE_SET(m, 002050);
+  HISTORY_ADD(m, 002050, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02051  4423
+  CPU_COUNT(m, 002051, 04423);
+  COVERAGE_SET(m, 002051);
+  HISTORY_ADD(m, 002051, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 002052;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 2;
+  return res;
+}
+
+static int b02052(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002052] != 01040 ||
+      m->mem[002053] != 01045 || m->breakpoints[002053] ||
+      m->mem[002054] != 03257 || m->breakpoints[002054] ||
+      m->mem[002055] != 07340 || m->breakpoints[002055] ||
+      m->mem[002056] != 03010 || m->breakpoints[002056] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02052  1040
+  CPU_COUNT(m, 002052, 01040);
+  COVERAGE_SET(m, 002052);
+  HISTORY_ADD(m, 002052, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02053  1045
+  CPU_COUNT(m, 002053, 01045);
+  COVERAGE_SET(m, 002053);
+  HISTORY_ADD(m, 002053, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02054  3257
+  CPU_COUNT(m, 002054, 03257);
+  COVERAGE_SET(m, 002054);
+  HISTORY_ADD(m, 002054, 03257, a, q);
+  cpma = 002057;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002052 && cpma <= 002056 ){
+    m->ac = a; m->mq = q; m->pc = 002055; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 02055  7340
+  CPU_COUNT(m, 002055, 07340);
+  COVERAGE_SET(m, 002055);
+  HISTORY_ADD(m, 002055, 07340, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  a ^= AC_MASK;
+
+  // 02056  3010
+  CPU_COUNT(m, 002056, 03010);
+  COVERAGE_SET(m, 002056);
+  HISTORY_ADD(m, 002056, 03010, a, q);
+  cpma = 000010;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 002057;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b02055(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002055] != 07340 ||
+      m->mem[002056] != 03010 || m->breakpoints[002056] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02055  7340
+  CPU_COUNT(m, 002055, 07340);
+  COVERAGE_SET(m, 002055);
+  HISTORY_ADD(m, 002055, 07340, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  a ^= AC_MASK;
+
+  // 02056  3010
+  CPU_COUNT(m, 002056, 03010);
+  COVERAGE_SET(m, 002056);
+  HISTORY_ADD(m, 002056, 03010, a, q);
+  cpma = 000010;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 002057;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02060(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002060] != 04276 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02060  4276
+  CPU_COUNT(m, 002060, 04276);
+  COVERAGE_SET(m, 002060);
+  HISTORY_ADD(m, 002060, 04276, a, q);
+  cpma = 002076;
+  m->pc = 002061;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02061(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002061] != 07340 ||
+      m->mem[002062] != 03010 || m->breakpoints[002062] ||
+      m->mem[002063] != 04312 || m->breakpoints[002063] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02061  7340
+  CPU_COUNT(m, 002061, 07340);
+  COVERAGE_SET(m, 002061);
+  HISTORY_ADD(m, 002061, 07340, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  a ^= AC_MASK;
+
+  // 02062  3010
+  CPU_COUNT(m, 002062, 03010);
+  COVERAGE_SET(m, 002062);
+  HISTORY_ADD(m, 002062, 03010, a, q);
+  cpma = 000010;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002061 && cpma <= 002063 ){
+    m->ac = a; m->mq = q; m->pc = 002063; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 02063  4312
+  CPU_COUNT(m, 002063, 04312);
+  COVERAGE_SET(m, 002063);
+  HISTORY_ADD(m, 002063, 04312, a, q);
+  cpma = 002112;
+  m->pc = 002064;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b02064(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002064] != 07300 ||
+      m->mem[002065] != 02031 || m->breakpoints[002065] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02064  7300
+  CPU_COUNT(m, 002064, 07300);
+  COVERAGE_SET(m, 002064);
+  HISTORY_ADD(m, 002064, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02065  2031
+  CPU_COUNT(m, 002065, 02031);
+  COVERAGE_SET(m, 002065);
+  HISTORY_ADD(m, 002065, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002067 : 002066;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02066(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002066] != 07410 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02066  7410
+  CPU_COUNT(m, 002066, 07410);
+  COVERAGE_SET(m, 002066);
+  HISTORY_ADD(m, 002066, 07410, a, q);
+  cond = 0;
+  m->pc = ! cond ? 002070 : 002067;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02067(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002067] != 05274 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02067  5274
+  CPU_COUNT(m, 002067, 05274);
+  COVERAGE_SET(m, 002067);
+  HISTORY_ADD(m, 002067, 05274, a, q);
+  cpma = 002074;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02070(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002070] != 01257 ||
+      m->mem[002071] != 01045 || m->breakpoints[002071] ||
+      m->mem[002072] != 03257 || m->breakpoints[002072] ||
+      m->mem[002073] != 05255 || m->breakpoints[002073] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02070  1257
+  CPU_COUNT(m, 002070, 01257);
+  COVERAGE_SET(m, 002070);
+  HISTORY_ADD(m, 002070, 01257, a, q);
+  cpma = 002057;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02071  1045
+  CPU_COUNT(m, 002071, 01045);
+  COVERAGE_SET(m, 002071);
+  HISTORY_ADD(m, 002071, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02072  3257
+  CPU_COUNT(m, 002072, 03257);
+  COVERAGE_SET(m, 002072);
+  HISTORY_ADD(m, 002072, 03257, a, q);
+  cpma = 002057;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002070 && cpma <= 002073 ){
+    m->ac = a; m->mq = q; m->pc = 002073; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 02073  5255
+  CPU_COUNT(m, 002073, 05255);
+  COVERAGE_SET(m, 002073);
+  HISTORY_ADD(m, 002073, 05255, a, q);
+  cpma = 002055;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 9000;
+  *count = 4;
+  return res;
+}
+
+static int b02075(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002075] != 05647 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02075  5647
+  CPU_COUNT(m, 002075, 05647);
+  COVERAGE_SET(m, 002075);
+  HISTORY_ADD(m, 002075, 05647, a, q);
+  cpma = 000000 | (m->mem[002047] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b02076(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002076] != 00000 ||
+      m->mem[002077] != 07300 || m->breakpoints[002077] ||
+      m->mem[002100] != 01157 || m->breakpoints[002100] ||
+      m->mem[002101] != 03410 || m->breakpoints[002101] ||
+      m->mem[002102] != 01157 || m->breakpoints[002102] ||
+      m->mem[002103] != 07040 || m->breakpoints[002103] ||
+      m->mem[002104] != 03410 || m->breakpoints[002104] ||
+      m->mem[002105] != 01010 || m->breakpoints[002105] ||
+      m->mem[002106] != 07001 || m->breakpoints[002106] ||
+      m->mem[002107] != 07640 || m->breakpoints[002107] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 10 || m->time + 22000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02076  0000
+  CPU_COUNT(m, 002076, 00000);
+  COVERAGE_SET(m, 002076);
+  HISTORY_ADD(m, 002076, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02077  7300
+  CPU_COUNT(m, 002077, 07300);
+  COVERAGE_SET(m, 002077);
+  HISTORY_ADD(m, 002077, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02100  1157
+  CPU_COUNT(m, 002100, 01157);
+  COVERAGE_SET(m, 002100);
+  HISTORY_ADD(m, 002100, 01157, a, q);
+  cpma = 000157;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02101  3410
+  CPU_COUNT(m, 002101, 03410);
+  COVERAGE_SET(m, 002101);
+  HISTORY_ADD(m, 002101, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002076 && cpma <= 002107 ){
+    m->ac = a; m->mq = q; m->pc = 002102; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 02102  1157
+  CPU_COUNT(m, 002102, 01157);
+  COVERAGE_SET(m, 002102);
+  HISTORY_ADD(m, 002102, 01157, a, q);
+  cpma = 000157;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02103  7040
+  CPU_COUNT(m, 002103, 07040);
+  COVERAGE_SET(m, 002103);
+  HISTORY_ADD(m, 002103, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 02104  3410
+  CPU_COUNT(m, 002104, 03410);
+  COVERAGE_SET(m, 002104);
+  HISTORY_ADD(m, 002104, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002076 && cpma <= 002107 ){
+    m->ac = a; m->mq = q; m->pc = 002105; *count = 7;
+    m->time += 18200;
+    return 0;
+  }
+
+  // 02105  1010
+  CPU_COUNT(m, 002105, 01010);
+  COVERAGE_SET(m, 002105);
+  HISTORY_ADD(m, 002105, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02106  7001
+  CPU_COUNT(m, 002106, 07001);
+  COVERAGE_SET(m, 002106);
+  HISTORY_ADD(m, 002106, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02107  7640
+  CPU_COUNT(m, 002107, 07640);
+  COVERAGE_SET(m, 002107);
+  HISTORY_ADD(m, 002107, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 002111 : 002110;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 23200;
+  *count = 10;
+  return res;
+}
+
+static int b02077(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002077] != 07300 ||
+      m->mem[002100] != 01157 || m->breakpoints[002100] ||
+      m->mem[002101] != 03410 || m->breakpoints[002101] ||
+      m->mem[002102] != 01157 || m->breakpoints[002102] ||
+      m->mem[002103] != 07040 || m->breakpoints[002103] ||
+      m->mem[002104] != 03410 || m->breakpoints[002104] ||
+      m->mem[002105] != 01010 || m->breakpoints[002105] ||
+      m->mem[002106] != 07001 || m->breakpoints[002106] ||
+      m->mem[002107] != 07640 || m->breakpoints[002107] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 9 || m->time + 19400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02077  7300
+  CPU_COUNT(m, 002077, 07300);
+  COVERAGE_SET(m, 002077);
+  HISTORY_ADD(m, 002077, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02100  1157
+  CPU_COUNT(m, 002100, 01157);
+  COVERAGE_SET(m, 002100);
+  HISTORY_ADD(m, 002100, 01157, a, q);
+  cpma = 000157;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02101  3410
+  CPU_COUNT(m, 002101, 03410);
+  COVERAGE_SET(m, 002101);
+  HISTORY_ADD(m, 002101, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002077 && cpma <= 002107 ){
+    m->ac = a; m->mq = q; m->pc = 002102; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 02102  1157
+  CPU_COUNT(m, 002102, 01157);
+  COVERAGE_SET(m, 002102);
+  HISTORY_ADD(m, 002102, 01157, a, q);
+  cpma = 000157;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02103  7040
+  CPU_COUNT(m, 002103, 07040);
+  COVERAGE_SET(m, 002103);
+  HISTORY_ADD(m, 002103, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 02104  3410
+  CPU_COUNT(m, 002104, 03410);
+  COVERAGE_SET(m, 002104);
+  HISTORY_ADD(m, 002104, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002077 && cpma <= 002107 ){
+    m->ac = a; m->mq = q; m->pc = 002105; *count = 6;
+    m->time += 15600;
+    return 0;
+  }
+
+  // 02105  1010
+  CPU_COUNT(m, 002105, 01010);
+  COVERAGE_SET(m, 002105);
+  HISTORY_ADD(m, 002105, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02106  7001
+  CPU_COUNT(m, 002106, 07001);
+  COVERAGE_SET(m, 002106);
+  HISTORY_ADD(m, 002106, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02107  7640
+  CPU_COUNT(m, 002107, 07640);
+  COVERAGE_SET(m, 002107);
+  HISTORY_ADD(m, 002107, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 002111 : 002110;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 20600;
+  *count = 9;
+  return res;
+}
+
+static int b02110(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002110] != 05277 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02110  5277
+  CPU_COUNT(m, 002110, 05277);
+  COVERAGE_SET(m, 002110);
+  HISTORY_ADD(m, 002110, 05277, a, q);
+  cpma = 002077;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02111(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002111] != 05676 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02111  5676
+  CPU_COUNT(m, 002111, 05676);
+  COVERAGE_SET(m, 002111);
+  HISTORY_ADD(m, 002111, 05676, a, q);
+  cpma = 000000 | (m->mem[002076] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b02113(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002113] != 07300 ||
+      m->mem[002114] != 01410 || m->breakpoints[002114] ||
+      m->mem[002115] != 07001 || m->breakpoints[002115] ||
+      m->mem[002116] != 01410 || m->breakpoints[002116] ||
+      m->mem[002117] != 07440 || m->breakpoints[002117] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 10400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02113  7300
+  CPU_COUNT(m, 002113, 07300);
+  COVERAGE_SET(m, 002113);
+  HISTORY_ADD(m, 002113, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02114  1410
+  CPU_COUNT(m, 002114, 01410);
+  COVERAGE_SET(m, 002114);
+  HISTORY_ADD(m, 002114, 01410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02115  7001
+  CPU_COUNT(m, 002115, 07001);
+  COVERAGE_SET(m, 002115);
+  HISTORY_ADD(m, 002115, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02116  1410
+  CPU_COUNT(m, 002116, 01410);
+  COVERAGE_SET(m, 002116);
+  HISTORY_ADD(m, 002116, 01410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02117  7440
+  CPU_COUNT(m, 002117, 07440);
+  COVERAGE_SET(m, 002117);
+  HISTORY_ADD(m, 002117, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002121 : 002120;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b02120(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002120] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02120  7402
+  CPU_COUNT(m, 002120, 07402);
+  COVERAGE_SET(m, 002120);
+  HISTORY_ADD(m, 002120, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002122 : 002121;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02121(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002121] != 07300 ||
+      m->mem[002122] != 01010 || m->breakpoints[002122] ||
+      m->mem[002123] != 07001 || m->breakpoints[002123] ||
+      m->mem[002124] != 07640 || m->breakpoints[002124] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 5000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02121  7300
+  CPU_COUNT(m, 002121, 07300);
+  COVERAGE_SET(m, 002121);
+  HISTORY_ADD(m, 002121, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02122  1010
+  CPU_COUNT(m, 002122, 01010);
+  COVERAGE_SET(m, 002122);
+  HISTORY_ADD(m, 002122, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02123  7001
+  CPU_COUNT(m, 002123, 07001);
+  COVERAGE_SET(m, 002123);
+  HISTORY_ADD(m, 002123, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02124  7640
+  CPU_COUNT(m, 002124, 07640);
+  COVERAGE_SET(m, 002124);
+  HISTORY_ADD(m, 002124, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 002126 : 002125;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6200;
+  *count = 4;
+  return res;
+}
+
+static int b02122(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002122] != 01010 ||
+      m->mem[002123] != 07001 || m->breakpoints[002123] ||
+      m->mem[002124] != 07640 || m->breakpoints[002124] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02122  1010
+  CPU_COUNT(m, 002122, 01010);
+  COVERAGE_SET(m, 002122);
+  HISTORY_ADD(m, 002122, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02123  7001
+  CPU_COUNT(m, 002123, 07001);
+  COVERAGE_SET(m, 002123);
+  HISTORY_ADD(m, 002123, 07001, a, q);
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02124  7640
+  CPU_COUNT(m, 002124, 07640);
+  COVERAGE_SET(m, 002124);
+  HISTORY_ADD(m, 002124, 07640, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = cond ? 002126 : 002125;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b02125(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002125] != 05313 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02125  5313
+  CPU_COUNT(m, 002125, 05313);
+  COVERAGE_SET(m, 002125);
+  HISTORY_ADD(m, 002125, 05313, a, q);
+  cpma = 002113;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02126(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002126] != 05712 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02126  5712
+  CPU_COUNT(m, 002126, 05712);
+  COVERAGE_SET(m, 002126);
+  HISTORY_ADD(m, 002126, 05712, a, q);
+  cpma = 000000 | (m->mem[002112] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b02271(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002271] != 07300 ||
+      m->mem[002272] != 01020 || m->breakpoints[002272] ||
+      m->mem[002273] != 03001 || m->breakpoints[002273] ||
+      m->mem[002274] != 01040 || m->breakpoints[002274] ||
+      m->mem[002275] != 03304 || m->breakpoints[002275] ||
+      m->mem[002276] != 01304 || m->breakpoints[002276] ||
+      m->mem[002277] != 00111 || m->breakpoints[002277] ||
+      m->mem[002300] != 07120 || m->breakpoints[002300] ||
+      m->mem[002301] != 07010 || m->breakpoints[002301] ||
+      m->mem[002302] != 07012 || m->breakpoints[002302] ||
+      m->mem[002303] != 03112 || m->breakpoints[002303] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 11 || m->time + 20400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02271  7300
+  CPU_COUNT(m, 002271, 07300);
+  COVERAGE_SET(m, 002271);
+  HISTORY_ADD(m, 002271, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02272  1020
+  CPU_COUNT(m, 002272, 01020);
+  COVERAGE_SET(m, 002272);
+  HISTORY_ADD(m, 002272, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02273  3001
+  CPU_COUNT(m, 002273, 03001);
+  COVERAGE_SET(m, 002273);
+  HISTORY_ADD(m, 002273, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002271 && cpma <= 002303 ){
+    m->ac = a; m->mq = q; m->pc = 002274; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 02274  1040
+  CPU_COUNT(m, 002274, 01040);
+  COVERAGE_SET(m, 002274);
+  HISTORY_ADD(m, 002274, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02275  3304
+  CPU_COUNT(m, 002275, 03304);
+  COVERAGE_SET(m, 002275);
+  HISTORY_ADD(m, 002275, 03304, a, q);
+  cpma = 002304;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002271 && cpma <= 002303 ){
+    m->ac = a; m->mq = q; m->pc = 002276; *count = 5;
+    m->time += 11600;
+    return 0;
+  }
+
+  // 02276  1304
+  CPU_COUNT(m, 002276, 01304);
+  COVERAGE_SET(m, 002276);
+  HISTORY_ADD(m, 002276, 01304, a, q);
+  cpma = 002304;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02277  0111
+  CPU_COUNT(m, 002277, 00111);
+  COVERAGE_SET(m, 002277);
+  HISTORY_ADD(m, 002277, 00111, a, q);
+  cpma = 000111;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02300  7120
+  CPU_COUNT(m, 002300, 07120);
+  COVERAGE_SET(m, 002300);
+  HISTORY_ADD(m, 002300, 07120, a, q);
+  a &= AC_MASK;
+  a ^= LINK_MASK;
+
+  // 02301  7010
+  CPU_COUNT(m, 002301, 07010);
+  COVERAGE_SET(m, 002301);
+  HISTORY_ADD(m, 002301, 07010, a, q);
+  a = (a >> 1) | ((a & 1) << 12);
+
+  // 02302  7012
+  CPU_COUNT(m, 002302, 07012);
+  COVERAGE_SET(m, 002302);
+  HISTORY_ADD(m, 002302, 07012, a, q);
+  a = (a >> 1) | ((a & 1) << 12);
+  a = (a >> 1) | ((a & 1) << 12);
+
+  // 02303  3112
+  CPU_COUNT(m, 002303, 03112);
+  COVERAGE_SET(m, 002303);
+  HISTORY_ADD(m, 002303, 03112, a, q);
+  cpma = 000112;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 002304;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 23000;
+  *count = 11;
+  return res;
+}
+
+static int b02276(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002276] != 01304 ||
+      m->mem[002277] != 00111 || m->breakpoints[002277] ||
+      m->mem[002300] != 07120 || m->breakpoints[002300] ||
+      m->mem[002301] != 07010 || m->breakpoints[002301] ||
+      m->mem[002302] != 07012 || m->breakpoints[002302] ||
+      m->mem[002303] != 03112 || m->breakpoints[002303] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 8800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02276  1304
+  CPU_COUNT(m, 002276, 01304);
+  COVERAGE_SET(m, 002276);
+  HISTORY_ADD(m, 002276, 01304, a, q);
+  cpma = 002304;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02277  0111
+  CPU_COUNT(m, 002277, 00111);
+  COVERAGE_SET(m, 002277);
+  HISTORY_ADD(m, 002277, 00111, a, q);
+  cpma = 000111;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02300  7120
+  CPU_COUNT(m, 002300, 07120);
+  COVERAGE_SET(m, 002300);
+  HISTORY_ADD(m, 002300, 07120, a, q);
+  a &= AC_MASK;
+  a ^= LINK_MASK;
+
+  // 02301  7010
+  CPU_COUNT(m, 002301, 07010);
+  COVERAGE_SET(m, 002301);
+  HISTORY_ADD(m, 002301, 07010, a, q);
+  a = (a >> 1) | ((a & 1) << 12);
+
+  // 02302  7012
+  CPU_COUNT(m, 002302, 07012);
+  COVERAGE_SET(m, 002302);
+  HISTORY_ADD(m, 002302, 07012, a, q);
+  a = (a >> 1) | ((a & 1) << 12);
+  a = (a >> 1) | ((a & 1) << 12);
+
+  // 02303  3112
+  CPU_COUNT(m, 002303, 03112);
+  COVERAGE_SET(m, 002303);
+  HISTORY_ADD(m, 002303, 03112, a, q);
+  cpma = 000112;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 002304;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11400;
+  *count = 6;
+  return res;
+}
+
+static int b02306(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002306] != 04422 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02306  4422
+  CPU_COUNT(m, 002306, 04422);
+  COVERAGE_SET(m, 002306);
+  HISTORY_ADD(m, 002306, 04422, a, q);
+  cpma = 000000 | (m->mem[000022] & B12_MASK);
+  m->pc = 002307;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b02310(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002310] != 07340 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02310  7340
+  CPU_COUNT(m, 002310, 07340);
+  COVERAGE_SET(m, 002310);
+  HISTORY_ADD(m, 002310, 07340, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  a ^= AC_MASK;
+  m->pc = 002311;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02312(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002312] != 07041 ||
+      m->mem[002313] != 01112 || m->breakpoints[002313] ||
+      m->mem[002314] != 07440 || m->breakpoints[002314] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02312  7041
+  CPU_COUNT(m, 002312, 07041);
+  COVERAGE_SET(m, 002312);
+  HISTORY_ADD(m, 002312, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02313  1112
+  CPU_COUNT(m, 002313, 01112);
+  COVERAGE_SET(m, 002313);
+  HISTORY_ADD(m, 002313, 01112, a, q);
+  cpma = 000112;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02314  7440
+  CPU_COUNT(m, 002314, 07440);
+  COVERAGE_SET(m, 002314);
+  HISTORY_ADD(m, 002314, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002316 : 002315;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b02313(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002313] != 01112 ||
+      m->mem[002314] != 07440 || m->breakpoints[002314] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02313  1112
+  CPU_COUNT(m, 002313, 01112);
+  COVERAGE_SET(m, 002313);
+  HISTORY_ADD(m, 002313, 01112, a, q);
+  cpma = 000112;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02314  7440
+  CPU_COUNT(m, 002314, 07440);
+  COVERAGE_SET(m, 002314);
+  HISTORY_ADD(m, 002314, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002316 : 002315;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02315(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002315] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02315  7402
+  CPU_COUNT(m, 002315, 07402);
+  COVERAGE_SET(m, 002315);
+  HISTORY_ADD(m, 002315, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002317 : 002316;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02316(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002316] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02316  2027
+  CPU_COUNT(m, 002316, 02027);
+  COVERAGE_SET(m, 002316);
+  HISTORY_ADD(m, 002316, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002320 : 002317;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02317(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002317] != 05276 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02317  5276
+  CPU_COUNT(m, 002317, 05276);
+  COVERAGE_SET(m, 002317);
+  HISTORY_ADD(m, 002317, 05276, a, q);
+  cpma = 002276;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02320(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002320] != 01045 ||
+      m->mem[002321] != 01304 || m->breakpoints[002321] ||
+      m->mem[002322] != 03304 || m->breakpoints[002322] ||
+      m->mem[002323] != 02113 || m->breakpoints[002323] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02320  1045
+  CPU_COUNT(m, 002320, 01045);
+  COVERAGE_SET(m, 002320);
+  HISTORY_ADD(m, 002320, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02321  1304
+  CPU_COUNT(m, 002321, 01304);
+  COVERAGE_SET(m, 002321);
+  HISTORY_ADD(m, 002321, 01304, a, q);
+  cpma = 002304;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02322  3304
+  CPU_COUNT(m, 002322, 03304);
+  COVERAGE_SET(m, 002322);
+  HISTORY_ADD(m, 002322, 03304, a, q);
+  cpma = 002304;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002320 && cpma <= 002323 ){
+    m->ac = a; m->mq = q; m->pc = 002323; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 02323  2113
+  CPU_COUNT(m, 002323, 02113);
+  COVERAGE_SET(m, 002323);
+  HISTORY_ADD(m, 002323, 02113, a, q);
+  cpma = 000113;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002325 : 002324;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b02324(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002324] != 05276 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02324  5276
+  CPU_COUNT(m, 002324, 05276);
+  COVERAGE_SET(m, 002324);
+  HISTORY_ADD(m, 002324, 05276, a, q);
+  cpma = 002276;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02325(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002325] != 01110 ||
+      m->mem[002326] != 03113 || m->breakpoints[002326] ||
+      m->mem[002327] != 05730 || m->breakpoints[002327] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 5200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02325  1110
+  CPU_COUNT(m, 002325, 01110);
+  COVERAGE_SET(m, 002325);
+  HISTORY_ADD(m, 002325, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02326  3113
+  CPU_COUNT(m, 002326, 03113);
+  COVERAGE_SET(m, 002326);
+  HISTORY_ADD(m, 002326, 03113, a, q);
+  cpma = 000113;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002325 && cpma <= 002327 ){
+    m->ac = a; m->mq = q; m->pc = 002327; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 02327  5730
+  CPU_COUNT(m, 002327, 05730);
+  COVERAGE_SET(m, 002327);
+  HISTORY_ADD(m, 002327, 05730, a, q);
+  cpma = 000000 | (m->mem[002330] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 7600;
+  *count = 3;
+  return res;
+}
+
+static int b02331(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002331] != 07300 ||
+      m->mem[002332] != 01021 || m->breakpoints[002332] ||
+      m->mem[002333] != 03001 || m->breakpoints[002333] ||
+      m->mem[002334] != 01020 || m->breakpoints[002334] ||
+      m->mem[002335] != 03002 || m->breakpoints[002335] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02331  7300
+  CPU_COUNT(m, 002331, 07300);
+  COVERAGE_SET(m, 002331);
+  HISTORY_ADD(m, 002331, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02332  1021
+  CPU_COUNT(m, 002332, 01021);
+  COVERAGE_SET(m, 002332);
+  HISTORY_ADD(m, 002332, 01021, a, q);
+  cpma = 000021;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02333  3001
+  CPU_COUNT(m, 002333, 03001);
+  COVERAGE_SET(m, 002333);
+  HISTORY_ADD(m, 002333, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002331 && cpma <= 002335 ){
+    m->ac = a; m->mq = q; m->pc = 002334; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 02334  1020
+  CPU_COUNT(m, 002334, 01020);
+  COVERAGE_SET(m, 002334);
+  HISTORY_ADD(m, 002334, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02335  3002
+  CPU_COUNT(m, 002335, 03002);
+  COVERAGE_SET(m, 002335);
+  HISTORY_ADD(m, 002335, 03002, a, q);
+  cpma = 000002;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 002336;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b02337(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002337] != 05340 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02337  5340
+  CPU_COUNT(m, 002337, 05340);
+  COVERAGE_SET(m, 002337);
+  HISTORY_ADD(m, 002337, 05340, a, q);
+  cpma = 002340;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02340(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002340] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02340  7402
+  CPU_COUNT(m, 002340, 07402);
+  COVERAGE_SET(m, 002340);
+  HISTORY_ADD(m, 002340, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002342 : 002341;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02341(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002341] != 07300 ||
+      m->mem[002342] != 01115 || m->breakpoints[002342] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02341  7300
+  CPU_COUNT(m, 002341, 07300);
+  COVERAGE_SET(m, 002341);
+  HISTORY_ADD(m, 002341, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02342  1115
+  CPU_COUNT(m, 002342, 01115);
+  COVERAGE_SET(m, 002342);
+  HISTORY_ADD(m, 002342, 01115, a, q);
+  cpma = 000115;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 002343;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02342(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002342] != 01115 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02342  1115
+  CPU_COUNT(m, 002342, 01115);
+  COVERAGE_SET(m, 002342);
+  HISTORY_ADD(m, 002342, 01115, a, q);
+  cpma = 000115;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 002343;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02344(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002344] != 07240 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02344  7240
+  CPU_COUNT(m, 002344, 07240);
+  COVERAGE_SET(m, 002344);
+  HISTORY_ADD(m, 002344, 07240, a, q);
+  a &= LINK_MASK;
+  a ^= AC_MASK;
+  m->pc = 002345;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02346(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002346] != 07041 ||
+      m->mem[002347] != 01115 || m->breakpoints[002347] ||
+      m->mem[002350] != 07440 || m->breakpoints[002350] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02346  7041
+  CPU_COUNT(m, 002346, 07041);
+  COVERAGE_SET(m, 002346);
+  HISTORY_ADD(m, 002346, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02347  1115
+  CPU_COUNT(m, 002347, 01115);
+  COVERAGE_SET(m, 002347);
+  HISTORY_ADD(m, 002347, 01115, a, q);
+  cpma = 000115;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02350  7440
+  CPU_COUNT(m, 002350, 07440);
+  COVERAGE_SET(m, 002350);
+  HISTORY_ADD(m, 002350, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002352 : 002351;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b02347(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002347] != 01115 ||
+      m->mem[002350] != 07440 || m->breakpoints[002350] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02347  1115
+  CPU_COUNT(m, 002347, 01115);
+  COVERAGE_SET(m, 002347);
+  HISTORY_ADD(m, 002347, 01115, a, q);
+  cpma = 000115;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02350  7440
+  CPU_COUNT(m, 002350, 07440);
+  COVERAGE_SET(m, 002350);
+  HISTORY_ADD(m, 002350, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002352 : 002351;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02351(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002351] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02351  7402
+  CPU_COUNT(m, 002351, 07402);
+  COVERAGE_SET(m, 002351);
+  HISTORY_ADD(m, 002351, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002353 : 002352;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02352(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002352] != 07300 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02352  7300
+  CPU_COUNT(m, 002352, 07300);
+  COVERAGE_SET(m, 002352);
+  HISTORY_ADD(m, 002352, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  m->pc = 002353;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02354(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002354] != 07300 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02354  7300
+  CPU_COUNT(m, 002354, 07300);
+  COVERAGE_SET(m, 002354);
+  HISTORY_ADD(m, 002354, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  m->pc = 002355;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02356(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002356] != 07041 ||
+      m->mem[002357] != 01116 || m->breakpoints[002357] ||
+      m->mem[002360] != 07440 || m->breakpoints[002360] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02356  7041
+  CPU_COUNT(m, 002356, 07041);
+  COVERAGE_SET(m, 002356);
+  HISTORY_ADD(m, 002356, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02357  1116
+  CPU_COUNT(m, 002357, 01116);
+  COVERAGE_SET(m, 002357);
+  HISTORY_ADD(m, 002357, 01116, a, q);
+  cpma = 000116;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02360  7440
+  CPU_COUNT(m, 002360, 07440);
+  COVERAGE_SET(m, 002360);
+  HISTORY_ADD(m, 002360, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002362 : 002361;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b02357(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002357] != 01116 ||
+      m->mem[002360] != 07440 || m->breakpoints[002360] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 2600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02357  1116
+  CPU_COUNT(m, 002357, 01116);
+  COVERAGE_SET(m, 002357);
+  HISTORY_ADD(m, 002357, 01116, a, q);
+  cpma = 000116;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02360  7440
+  CPU_COUNT(m, 002360, 07440);
+  COVERAGE_SET(m, 002360);
+  HISTORY_ADD(m, 002360, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002362 : 002361;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02361(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002361] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02361  7402
+  CPU_COUNT(m, 002361, 07402);
+  COVERAGE_SET(m, 002361);
+  HISTORY_ADD(m, 002361, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002363 : 002362;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02362(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002362] != 05363 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02362  5363
+  CPU_COUNT(m, 002362, 05363);
+  COVERAGE_SET(m, 002362);
+  HISTORY_ADD(m, 002362, 05363, a, q);
+  cpma = 002363;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02363(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002363] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02363  7402
+  CPU_COUNT(m, 002363, 07402);
+  COVERAGE_SET(m, 002363);
+  HISTORY_ADD(m, 002363, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002365 : 002364;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02364(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002364] != 07300 ||
+      m->mem[002365] != 02027 || m->breakpoints[002365] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02364  7300
+  CPU_COUNT(m, 002364, 07300);
+  COVERAGE_SET(m, 002364);
+  HISTORY_ADD(m, 002364, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02365  2027
+  CPU_COUNT(m, 002365, 02027);
+  COVERAGE_SET(m, 002365);
+  HISTORY_ADD(m, 002365, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002367 : 002366;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b02365(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002365] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02365  2027
+  CPU_COUNT(m, 002365, 02027);
+  COVERAGE_SET(m, 002365);
+  HISTORY_ADD(m, 002365, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002367 : 002366;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02366(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002366] != 05331 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02366  5331
+  CPU_COUNT(m, 002366, 05331);
+  COVERAGE_SET(m, 002366);
+  HISTORY_ADD(m, 002366, 05331, a, q);
+  cpma = 002331;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02367(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002367] != 04555 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02367  4555
+  CPU_COUNT(m, 002367, 04555);
+  COVERAGE_SET(m, 002367);
+  HISTORY_ADD(m, 002367, 04555, a, q);
+  cpma = 000000 | (m->mem[000155] & B12_MASK);
+  m->pc = 002370;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b02370(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002370] != 04773 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02370  4773
+  CPU_COUNT(m, 002370, 04773);
+  COVERAGE_SET(m, 002370);
+  HISTORY_ADD(m, 002370, 04773, a, q);
+  cpma = 000000 | (m->mem[002373] & B12_MASK);
+  m->pc = 002371;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b02371(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002371] != 05772 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02371  5772
+  CPU_COUNT(m, 002371, 05772);
+  COVERAGE_SET(m, 002371);
+  HISTORY_ADD(m, 002371, 05772, a, q);
+  cpma = 000000 | (m->mem[002372] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b02400(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002400] != 07300 ||
+      m->mem[002401] != 04422 || m->breakpoints[002401] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02400  7300
+  CPU_COUNT(m, 002400, 07300);
+  COVERAGE_SET(m, 002400);
+  HISTORY_ADD(m, 002400, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02401  4422
+  CPU_COUNT(m, 002401, 04422);
+  COVERAGE_SET(m, 002401);
+  HISTORY_ADD(m, 002401, 04422, a, q);
+  cpma = 000000 | (m->mem[000022] & B12_MASK);
+  m->pc = 002402;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 2;
+  return res;
+}
+
+static int b02402(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002402] != 01021 ||
+      m->mem[002403] != 03001 || m->breakpoints[002403] ||
+      m->mem[002404] != 01020 || m->breakpoints[002404] ||
+      m->mem[002405] != 03002 || m->breakpoints[002405] ||
+      m->mem[002406] != 03114 || m->breakpoints[002406] ||
+      m->mem[002407] != 01114 || m->breakpoints[002407] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 6 || m->time + 13000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02402  1021
+  CPU_COUNT(m, 002402, 01021);
+  COVERAGE_SET(m, 002402);
+  HISTORY_ADD(m, 002402, 01021, a, q);
+  cpma = 000021;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02403  3001
+  CPU_COUNT(m, 002403, 03001);
+  COVERAGE_SET(m, 002403);
+  HISTORY_ADD(m, 002403, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002402 && cpma <= 002407 ){
+    m->ac = a; m->mq = q; m->pc = 002404; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 02404  1020
+  CPU_COUNT(m, 002404, 01020);
+  COVERAGE_SET(m, 002404);
+  HISTORY_ADD(m, 002404, 01020, a, q);
+  cpma = 000020;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02405  3002
+  CPU_COUNT(m, 002405, 03002);
+  COVERAGE_SET(m, 002405);
+  HISTORY_ADD(m, 002405, 03002, a, q);
+  cpma = 000002;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002402 && cpma <= 002407 ){
+    m->ac = a; m->mq = q; m->pc = 002406; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 02406  3114
+  CPU_COUNT(m, 002406, 03114);
+  COVERAGE_SET(m, 002406);
+  HISTORY_ADD(m, 002406, 03114, a, q);
+  cpma = 000114;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002402 && cpma <= 002407 ){
+    m->ac = a; m->mq = q; m->pc = 002407; *count = 5;
+    m->time += 13000;
+    return 0;
+  }
+
+  // 02407  1114
+  CPU_COUNT(m, 002407, 01114);
+  COVERAGE_SET(m, 002407);
+  HISTORY_ADD(m, 002407, 01114, a, q);
+  cpma = 000114;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 002410;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 15600;
+  *count = 6;
+  return res;
+}
+
+static int b02407(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002407] != 01114 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02407  1114
+  CPU_COUNT(m, 002407, 01114);
+  COVERAGE_SET(m, 002407);
+  HISTORY_ADD(m, 002407, 01114, a, q);
+  cpma = 000114;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 002410;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02411(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002411] != 05212 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02411  5212
+  CPU_COUNT(m, 002411, 05212);
+  COVERAGE_SET(m, 002411);
+  HISTORY_ADD(m, 002411, 05212, a, q);
+  cpma = 002412;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02412(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002412] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02412  7402
+  CPU_COUNT(m, 002412, 07402);
+  COVERAGE_SET(m, 002412);
+  HISTORY_ADD(m, 002412, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002414 : 002413;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02413(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002413] != 07300 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02413  7300
+  CPU_COUNT(m, 002413, 07300);
+  COVERAGE_SET(m, 002413);
+  HISTORY_ADD(m, 002413, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+  m->pc = 002414;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02415(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002415] != 00117 ||
+      m->mem[002416] != 07041 || m->breakpoints[002416] ||
+      m->mem[002417] != 01114 || m->breakpoints[002417] ||
+      m->mem[002420] != 07440 || m->breakpoints[002420] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 6400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02415  0117
+  CPU_COUNT(m, 002415, 00117);
+  COVERAGE_SET(m, 002415);
+  HISTORY_ADD(m, 002415, 00117, a, q);
+  cpma = 000117;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02416  7041
+  CPU_COUNT(m, 002416, 07041);
+  COVERAGE_SET(m, 002416);
+  HISTORY_ADD(m, 002416, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02417  1114
+  CPU_COUNT(m, 002417, 01114);
+  COVERAGE_SET(m, 002417);
+  HISTORY_ADD(m, 002417, 01114, a, q);
+  cpma = 000114;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02420  7440
+  CPU_COUNT(m, 002420, 07440);
+  COVERAGE_SET(m, 002420);
+  HISTORY_ADD(m, 002420, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002422 : 002421;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 7600;
+  *count = 4;
+  return res;
+}
+
+static int b02416(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002416] != 07041 ||
+      m->mem[002417] != 01114 || m->breakpoints[002417] ||
+      m->mem[002420] != 07440 || m->breakpoints[002420] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02416  7041
+  CPU_COUNT(m, 002416, 07041);
+  COVERAGE_SET(m, 002416);
+  HISTORY_ADD(m, 002416, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02417  1114
+  CPU_COUNT(m, 002417, 01114);
+  COVERAGE_SET(m, 002417);
+  HISTORY_ADD(m, 002417, 01114, a, q);
+  cpma = 000114;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02420  7440
+  CPU_COUNT(m, 002420, 07440);
+  COVERAGE_SET(m, 002420);
+  HISTORY_ADD(m, 002420, 07440, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = cond ? 002422 : 002421;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b02421(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002421] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02421  7402
+  CPU_COUNT(m, 002421, 07402);
+  COVERAGE_SET(m, 002421);
+  HISTORY_ADD(m, 002421, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 002423 : 002422;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02422(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002422] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02422  2027
+  CPU_COUNT(m, 002422, 02027);
+  COVERAGE_SET(m, 002422);
+  HISTORY_ADD(m, 002422, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002424 : 002423;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b02423(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002423] != 05207 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02423  5207
+  CPU_COUNT(m, 002423, 05207);
+  COVERAGE_SET(m, 002423);
+  HISTORY_ADD(m, 002423, 05207, a, q);
+  cpma = 002407;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02424(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002424] != 01114 ||
+      m->mem[002425] != 01120 || m->breakpoints[002425] ||
+      m->mem[002426] != 03114 || m->breakpoints[002426] ||
+      m->mem[002427] != 02113 || m->breakpoints[002427] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02424  1114
+  CPU_COUNT(m, 002424, 01114);
+  COVERAGE_SET(m, 002424);
+  HISTORY_ADD(m, 002424, 01114, a, q);
+  cpma = 000114;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02425  1120
+  CPU_COUNT(m, 002425, 01120);
+  COVERAGE_SET(m, 002425);
+  HISTORY_ADD(m, 002425, 01120, a, q);
+  cpma = 000120;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02426  3114
+  CPU_COUNT(m, 002426, 03114);
+  COVERAGE_SET(m, 002426);
+  HISTORY_ADD(m, 002426, 03114, a, q);
+  cpma = 000114;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002424 && cpma <= 002427 ){
+    m->ac = a; m->mq = q; m->pc = 002427; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 02427  2113
+  CPU_COUNT(m, 002427, 02113);
+  COVERAGE_SET(m, 002427);
+  HISTORY_ADD(m, 002427, 02113, a, q);
+  cpma = 000113;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002431 : 002430;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b02430(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002430] != 05207 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02430  5207
+  CPU_COUNT(m, 002430, 05207);
+  COVERAGE_SET(m, 002430);
+  HISTORY_ADD(m, 002430, 05207, a, q);
+  cpma = 002407;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02431(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002431] != 01110 ||
+      m->mem[002432] != 03113 || m->breakpoints[002432] ||
+      m->mem[002433] != 05634 || m->breakpoints[002433] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 5200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02431  1110
+  CPU_COUNT(m, 002431, 01110);
+  COVERAGE_SET(m, 002431);
+  HISTORY_ADD(m, 002431, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02432  3113
+  CPU_COUNT(m, 002432, 03113);
+  COVERAGE_SET(m, 002432);
+  HISTORY_ADD(m, 002432, 03113, a, q);
+  cpma = 000113;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002431 && cpma <= 002433 ){
+    m->ac = a; m->mq = q; m->pc = 002433; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 02433  5634
+  CPU_COUNT(m, 002433, 05634);
+  COVERAGE_SET(m, 002433);
+  HISTORY_ADD(m, 002433, 05634, a, q);
+  cpma = 000000 | (m->mem[002434] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 7600;
+  *count = 3;
+  return res;
+}
+
+static int b02436(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[002436] != 07604 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02436  7604
+  CPU_COUNT(m, 002436, 07604);
+  COVERAGE_SET(m, 002436);
+  HISTORY_ADD(m, 002436, 07604, a, q);
+  cond = 0;
+  a &= LINK_MASK;
+  m->pc = cond ? 002440 : 002437;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    a |= m->sr;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02437(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002437] != 00044 ||
+      m->mem[002440] != 07041 || m->breakpoints[002440] ||
+      m->mem[002441] != 03031 || m->breakpoints[002441] ||
+      m->mem[002442] != 05635 || m->breakpoints[002442] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 6400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02437  0044
+  CPU_COUNT(m, 002437, 00044);
+  COVERAGE_SET(m, 002437);
+  HISTORY_ADD(m, 002437, 00044, a, q);
+  cpma = 000044;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02440  7041
+  CPU_COUNT(m, 002440, 07041);
+  COVERAGE_SET(m, 002440);
+  HISTORY_ADD(m, 002440, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02441  3031
+  CPU_COUNT(m, 002441, 03031);
+  COVERAGE_SET(m, 002441);
+  HISTORY_ADD(m, 002441, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002437 && cpma <= 002442 ){
+    m->ac = a; m->mq = q; m->pc = 002442; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 02442  5635
+  CPU_COUNT(m, 002442, 05635);
+  COVERAGE_SET(m, 002442);
+  HISTORY_ADD(m, 002442, 05635, a, q);
+  cpma = 000000 | (m->mem[002435] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 8800;
+  *count = 4;
+  return res;
+}
+
+static int b02440(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002440] != 07041 ||
+      m->mem[002441] != 03031 || m->breakpoints[002441] ||
+      m->mem[002442] != 05635 || m->breakpoints[002442] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02440  7041
+  CPU_COUNT(m, 002440, 07041);
+  COVERAGE_SET(m, 002440);
+  HISTORY_ADD(m, 002440, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 02441  3031
+  CPU_COUNT(m, 002441, 03031);
+  COVERAGE_SET(m, 002441);
+  HISTORY_ADD(m, 002441, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002440 && cpma <= 002442 ){
+    m->ac = a; m->mq = q; m->pc = 002442; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 02442  5635
+  CPU_COUNT(m, 002442, 05635);
+  COVERAGE_SET(m, 002442);
+  HISTORY_ADD(m, 002442, 05635, a, q);
+  cpma = 000000 | (m->mem[002435] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6200;
+  *count = 3;
+  return res;
+}
+
+static int b02444(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  int res = 0;
+
+  if( m->mem[002444] != 07200 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02444  7200
+  CPU_COUNT(m, 002444, 07200);
+  COVERAGE_SET(m, 002444);
+  HISTORY_ADD(m, 002444, 07200, a, q);
+  a &= LINK_MASK;
+  m->pc = 002445;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02447(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002447] != 05246 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02447  5246
+  CPU_COUNT(m, 002447, 05246);
+  COVERAGE_SET(m, 002447);
+  HISTORY_ADD(m, 002447, 05246, a, q);
+  cpma = 002446;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b02450(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002450] != 07200 ||
+      m->mem[002451] != 05643 || m->breakpoints[002451] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02450  7200
+  CPU_COUNT(m, 002450, 07200);
+  COVERAGE_SET(m, 002450);
+  HISTORY_ADD(m, 002450, 07200, a, q);
+  a &= LINK_MASK;
+
+  // 02451  5643
+  CPU_COUNT(m, 002451, 05643);
+  COVERAGE_SET(m, 002451);
+  HISTORY_ADD(m, 002451, 05643, a, q);
+  cpma = 000000 | (m->mem[002443] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3600;
+  *count = 2;
+  return res;
+}
+
+static int b02452(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002452] != 07300 ||
+      m->mem[002453] != 04423 || m->breakpoints[002453] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02452  7300
+  CPU_COUNT(m, 002452, 07300);
+  COVERAGE_SET(m, 002452);
+  HISTORY_ADD(m, 002452, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02453  4423
+  CPU_COUNT(m, 002453, 04423);
+  COVERAGE_SET(m, 002453);
+  HISTORY_ADD(m, 002453, 04423, a, q);
+  cpma = 000000 | (m->mem[000023] & B12_MASK);
+  m->pc = 002454;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 2;
+  return res;
+}
+
+static int b02454(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002454] != 01120 ||
+      m->mem[002455] != 03260 || m->breakpoints[002455] ||
+      m->mem[002456] != 01132 || m->breakpoints[002456] ||
+      m->mem[002457] != 03010 || m->breakpoints[002457] ||
+      m->mem[002460] != 00000 || m->breakpoints[002460] ||
+      m->mem[002461] != 07300 || m->breakpoints[002461] ||
+      m->mem[002462] != 01260 || m->breakpoints[002462] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 7 || m->time + 14200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02454  1120
+  CPU_COUNT(m, 002454, 01120);
+  COVERAGE_SET(m, 002454);
+  HISTORY_ADD(m, 002454, 01120, a, q);
+  cpma = 000120;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02455  3260
+  CPU_COUNT(m, 002455, 03260);
+  COVERAGE_SET(m, 002455);
+  HISTORY_ADD(m, 002455, 03260, a, q);
+  cpma = 002460;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002454 && cpma <= 002462 ){
+    m->ac = a; m->mq = q; m->pc = 002456; *count = 2;
+    m->time += 5200;
+    return 0;
+  }
+
+  // 02456  1132
+  CPU_COUNT(m, 002456, 01132);
+  COVERAGE_SET(m, 002456);
+  HISTORY_ADD(m, 002456, 01132, a, q);
+  cpma = 000132;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02457  3010
+  CPU_COUNT(m, 002457, 03010);
+  COVERAGE_SET(m, 002457);
+  HISTORY_ADD(m, 002457, 03010, a, q);
+  cpma = 000010;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002454 && cpma <= 002462 ){
+    m->ac = a; m->mq = q; m->pc = 002460; *count = 4;
+    m->time += 10400;
+    return 0;
+  }
+
+  // 02460  0000
+  CPU_COUNT(m, 002460, 00000);
+  COVERAGE_SET(m, 002460);
+  HISTORY_ADD(m, 002460, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 02461  7300
+  CPU_COUNT(m, 002461, 07300);
+  COVERAGE_SET(m, 002461);
+  HISTORY_ADD(m, 002461, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02462  1260
+  CPU_COUNT(m, 002462, 01260);
+  COVERAGE_SET(m, 002462);
+  HISTORY_ADD(m, 002462, 01260, a, q);
+  cpma = 002460;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+  m->pc = 002463;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 16800;
+  *count = 7;
+  return res;
+}
+
+static int b02465(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002465] != 07300 ||
+      m->mem[002466] != 02537 || m->breakpoints[002466] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02465  7300
+  CPU_COUNT(m, 002465, 07300);
+  COVERAGE_SET(m, 002465);
+  HISTORY_ADD(m, 002465, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 02466  2537
+  CPU_COUNT(m, 002466, 02537);
+  COVERAGE_SET(m, 002466);
+  HISTORY_ADD(m, 002466, 02537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002470 : 002467;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 2;
+  return res;
+}
+
+static int b02466(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002466] != 02537 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02466  2537
+  CPU_COUNT(m, 002466, 02537);
+  COVERAGE_SET(m, 002466);
+  HISTORY_ADD(m, 002466, 02537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 002470 : 002467;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 1;
+  return res;
+}
+
+static int b02467(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002467] != 07000 ||
+      m->mem[002470] != 01537 || m->breakpoints[002470] ||
+      m->mem[002471] != 03136 || m->breakpoints[002471] ||
+      m->mem[002472] != 01124 || m->breakpoints[002472] ||
+      m->mem[002473] != 03541 || m->breakpoints[002473] ||
+      m->mem[002474] != 01133 || m->breakpoints[002474] ||
+      m->mem[002475] != 03410 || m->breakpoints[002475] ||
+      m->mem[002476] != 01130 || m->breakpoints[002476] ||
+      m->mem[002477] != 03410 || m->breakpoints[002477] ||
+      m->mem[002500] != 01124 || m->breakpoints[002500] ||
+      m->mem[002501] != 03410 || m->breakpoints[002501] ||
+      m->mem[002502] != 01010 || m->breakpoints[002502] ||
+      m->mem[002503] != 01057 || m->breakpoints[002503] ||
+      m->mem[002504] != 03310 || m->breakpoints[002504] ||
+      m->mem[002505] != 01134 || m->breakpoints[002505] ||
+      m->mem[002506] != 03001 || m->breakpoints[002506] ||
+      m->mem[002507] != 05710 || m->breakpoints[002507] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 17 || m->time + 46800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02467  7000
+  CPU_COUNT(m, 002467, 07000);
+  COVERAGE_SET(m, 002467);
+  HISTORY_ADD(m, 002467, 07000, a, q);
+
+  // 02470  1537
+  CPU_COUNT(m, 002470, 01537);
+  COVERAGE_SET(m, 002470);
+  HISTORY_ADD(m, 002470, 01537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02471  3136
+  CPU_COUNT(m, 002471, 03136);
+  COVERAGE_SET(m, 002471);
+  HISTORY_ADD(m, 002471, 03136, a, q);
+  cpma = 000136;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002472; *count = 3;
+    m->time += 7600;
+    return 0;
+  }
+
+  // 02472  1124
+  CPU_COUNT(m, 002472, 01124);
+  COVERAGE_SET(m, 002472);
+  HISTORY_ADD(m, 002472, 01124, a, q);
+  cpma = 000124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02473  3541
+  CPU_COUNT(m, 002473, 03541);
+  COVERAGE_SET(m, 002473);
+  HISTORY_ADD(m, 002473, 03541, a, q);
+  cpma = m->df_base | (m->mem[000141] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002474; *count = 5;
+    m->time += 14000;
+    return 0;
+  }
+
+  // 02474  1133
+  CPU_COUNT(m, 002474, 01133);
+  COVERAGE_SET(m, 002474);
+  HISTORY_ADD(m, 002474, 01133, a, q);
+  cpma = 000133;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02475  3410
+  CPU_COUNT(m, 002475, 03410);
+  COVERAGE_SET(m, 002475);
+  HISTORY_ADD(m, 002475, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002476; *count = 7;
+    m->time += 20600;
+    return 0;
+  }
+
+  // 02476  1130
+  CPU_COUNT(m, 002476, 01130);
+  COVERAGE_SET(m, 002476);
+  HISTORY_ADD(m, 002476, 01130, a, q);
+  cpma = 000130;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02477  3410
+  CPU_COUNT(m, 002477, 03410);
+  COVERAGE_SET(m, 002477);
+  HISTORY_ADD(m, 002477, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002500; *count = 9;
+    m->time += 27200;
+    return 0;
+  }
+
+  // 02500  1124
+  CPU_COUNT(m, 002500, 01124);
+  COVERAGE_SET(m, 002500);
+  HISTORY_ADD(m, 002500, 01124, a, q);
+  cpma = 000124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02501  3410
+  CPU_COUNT(m, 002501, 03410);
+  COVERAGE_SET(m, 002501);
+  HISTORY_ADD(m, 002501, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002502; *count = 11;
+    m->time += 33800;
+    return 0;
+  }
+
+  // 02502  1010
+  CPU_COUNT(m, 002502, 01010);
+  COVERAGE_SET(m, 002502);
+  HISTORY_ADD(m, 002502, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02503  1057
+  CPU_COUNT(m, 002503, 01057);
+  COVERAGE_SET(m, 002503);
+  HISTORY_ADD(m, 002503, 01057, a, q);
+  cpma = 000057;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02504  3310
+  CPU_COUNT(m, 002504, 03310);
+  COVERAGE_SET(m, 002504);
+  HISTORY_ADD(m, 002504, 03310, a, q);
+  cpma = 002510;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002505; *count = 14;
+    m->time += 41600;
+    return 0;
+  }
+
+  // 02505  1134
+  CPU_COUNT(m, 002505, 01134);
+  COVERAGE_SET(m, 002505);
+  HISTORY_ADD(m, 002505, 01134, a, q);
+  cpma = 000134;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02506  3001
+  CPU_COUNT(m, 002506, 03001);
+  COVERAGE_SET(m, 002506);
+  HISTORY_ADD(m, 002506, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002467 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002507; *count = 16;
+    m->time += 46800;
+    return 0;
+  }
+
+  // 02507  5710
+  CPU_COUNT(m, 002507, 05710);
+  COVERAGE_SET(m, 002507);
+  HISTORY_ADD(m, 002507, 05710, a, q);
+  cpma = 000000 | (m->mem[002510] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 49200;
+  *count = 17;
+  return res;
+}
+
+static int b02470(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[002470] != 01537 ||
+      m->mem[002471] != 03136 || m->breakpoints[002471] ||
+      m->mem[002472] != 01124 || m->breakpoints[002472] ||
+      m->mem[002473] != 03541 || m->breakpoints[002473] ||
+      m->mem[002474] != 01133 || m->breakpoints[002474] ||
+      m->mem[002475] != 03410 || m->breakpoints[002475] ||
+      m->mem[002476] != 01130 || m->breakpoints[002476] ||
+      m->mem[002477] != 03410 || m->breakpoints[002477] ||
+      m->mem[002500] != 01124 || m->breakpoints[002500] ||
+      m->mem[002501] != 03410 || m->breakpoints[002501] ||
+      m->mem[002502] != 01010 || m->breakpoints[002502] ||
+      m->mem[002503] != 01057 || m->breakpoints[002503] ||
+      m->mem[002504] != 03310 || m->breakpoints[002504] ||
+      m->mem[002505] != 01134 || m->breakpoints[002505] ||
+      m->mem[002506] != 03001 || m->breakpoints[002506] ||
+      m->mem[002507] != 05710 || m->breakpoints[002507] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 16 || m->time + 45600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 02470  1537
+  CPU_COUNT(m, 002470, 01537);
+  COVERAGE_SET(m, 002470);
+  HISTORY_ADD(m, 002470, 01537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02471  3136
+  CPU_COUNT(m, 002471, 03136);
+  COVERAGE_SET(m, 002471);
+  HISTORY_ADD(m, 002471, 03136, a, q);
+  cpma = 000136;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002472; *count = 2;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 02472  1124
+  CPU_COUNT(m, 002472, 01124);
+  COVERAGE_SET(m, 002472);
+  HISTORY_ADD(m, 002472, 01124, a, q);
+  cpma = 000124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02473  3541
+  CPU_COUNT(m, 002473, 03541);
+  COVERAGE_SET(m, 002473);
+  HISTORY_ADD(m, 002473, 03541, a, q);
+  cpma = m->df_base | (m->mem[000141] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002474; *count = 4;
+    m->time += 12800;
+    return 0;
+  }
+
+  // 02474  1133
+  CPU_COUNT(m, 002474, 01133);
+  COVERAGE_SET(m, 002474);
+  HISTORY_ADD(m, 002474, 01133, a, q);
+  cpma = 000133;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02475  3410
+  CPU_COUNT(m, 002475, 03410);
+  COVERAGE_SET(m, 002475);
+  HISTORY_ADD(m, 002475, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002476; *count = 6;
+    m->time += 19400;
+    return 0;
+  }
+
+  // 02476  1130
+  CPU_COUNT(m, 002476, 01130);
+  COVERAGE_SET(m, 002476);
+  HISTORY_ADD(m, 002476, 01130, a, q);
+  cpma = 000130;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02477  3410
+  CPU_COUNT(m, 002477, 03410);
+  COVERAGE_SET(m, 002477);
+  HISTORY_ADD(m, 002477, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002500; *count = 8;
+    m->time += 26000;
+    return 0;
+  }
+
+  // 02500  1124
+  CPU_COUNT(m, 002500, 01124);
+  COVERAGE_SET(m, 002500);
+  HISTORY_ADD(m, 002500, 01124, a, q);
+  cpma = 000124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02501  3410
+  CPU_COUNT(m, 002501, 03410);
+  COVERAGE_SET(m, 002501);
+  HISTORY_ADD(m, 002501, 03410, a, q);
+  cpu_store_mem(m, 000010, INC_12BIT(m->mem[000010]));
+  cpma = m->df_base | (m->mem[000010] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002502; *count = 10;
+    m->time += 32600;
+    return 0;
+  }
+
+  // 02502  1010
+  CPU_COUNT(m, 002502, 01010);
+  COVERAGE_SET(m, 002502);
+  HISTORY_ADD(m, 002502, 01010, a, q);
+  cpma = 000010;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02503  1057
+  CPU_COUNT(m, 002503, 01057);
+  COVERAGE_SET(m, 002503);
+  HISTORY_ADD(m, 002503, 01057, a, q);
+  cpma = 000057;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02504  3310
+  CPU_COUNT(m, 002504, 03310);
+  COVERAGE_SET(m, 002504);
+  HISTORY_ADD(m, 002504, 03310, a, q);
+  cpma = 002510;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002505; *count = 13;
+    m->time += 40400;
+    return 0;
+  }
+
+  // 02505  1134
+  CPU_COUNT(m, 002505, 01134);
+  COVERAGE_SET(m, 002505);
+  HISTORY_ADD(m, 002505, 01134, a, q);
+  cpma = 000134;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 02506  3001
+  CPU_COUNT(m, 002506, 03001);
+  COVERAGE_SET(m, 002506);
+  HISTORY_ADD(m, 002506, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 002470 && cpma <= 002507 ){
+    m->ac = a; m->mq = q; m->pc = 002507; *count = 15;
+    m->time += 45600;
+    return 0;
+  }
+
+  // 02507  5710
+  CPU_COUNT(m, 002507, 05710);
+  COVERAGE_SET(m, 002507);
+  HISTORY_ADD(m, 002507, 05710, a, q);
+  cpma = 000000 | (m->mem[002510] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 48000;
+  *count = 16;
+  return res;
+}
+
+static int b03643(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[003643] != 07300 ||
+      m->mem[003644] != 01153 || m->breakpoints[003644] ||
+      m->mem[003645] != 03001 || m->breakpoints[003645] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03643  7300
+  CPU_COUNT(m, 003643, 07300);
+  COVERAGE_SET(m, 003643);
+  HISTORY_ADD(m, 003643, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 03644  1153
+  CPU_COUNT(m, 003644, 01153);
+  COVERAGE_SET(m, 003644);
+  HISTORY_ADD(m, 003644, 01153, a, q);
+  cpma = 000153;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 03645  3001
+  CPU_COUNT(m, 003645, 03001);
+  COVERAGE_SET(m, 003645);
+  HISTORY_ADD(m, 003645, 03001, a, q);
+  cpma = 000001;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 003646;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b03650(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[003650] != 05251 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03650  5251
+  CPU_COUNT(m, 003650, 05251);
+  COVERAGE_SET(m, 003650);
+  HISTORY_ADD(m, 003650, 05251, a, q);
+  cpma = 003651;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b03651(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[003651] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03651  7402
+  CPU_COUNT(m, 003651, 07402);
+  COVERAGE_SET(m, 003651);
+  HISTORY_ADD(m, 003651, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 003653 : 003652;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b03653(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[003653] != 07410 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03653  7410
+  CPU_COUNT(m, 003653, 07410);
+  COVERAGE_SET(m, 003653);
+  HISTORY_ADD(m, 003653, 07410, a, q);
+  cond = 0;
+  m->pc = ! cond ? 003655 : 003654;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b03654(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[003654] != 07402 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03654  7402
+  CPU_COUNT(m, 003654, 07402);
+  COVERAGE_SET(m, 003654);
+  HISTORY_ADD(m, 003654, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 003656 : 003655;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b03657(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[003657] != 05527 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 03657  5527
+  CPU_COUNT(m, 003657, 05527);
+  COVERAGE_SET(m, 003657);
+  HISTORY_ADD(m, 003657, 05527, a, q);
+  cpma = 000000 | (m->mem[000127] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b04000(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004000] != 00000 ||
+      m->mem[004001] != 07300 || m->breakpoints[004001] ||
+      m->mem[004002] != 03323 || m->breakpoints[004002] ||
+      m->mem[004003] != 03324 || m->breakpoints[004003] ||
+      m->mem[004004] != 01040 || m->breakpoints[004004] ||
+      m->mem[004005] != 03232 || m->breakpoints[004005] ||
+      m->mem[004006] != 01110 || m->breakpoints[004006] ||
+      m->mem[004007] != 03327 || m->breakpoints[004007] ||
+      m->mem[004010] != 01110 || m->breakpoints[004010] ||
+      m->mem[004011] != 03031 || m->breakpoints[004011] ||
+      m->mem[004012] != 01040 || m->breakpoints[004012] ||
+      m->mem[004013] != 03214 || m->breakpoints[004013] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 12 || m->time + 27200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04000  0000
+  CPU_COUNT(m, 004000, 00000);
+  COVERAGE_SET(m, 004000);
+  HISTORY_ADD(m, 004000, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 04001  7300
+  CPU_COUNT(m, 004001, 07300);
+  COVERAGE_SET(m, 004001);
+  HISTORY_ADD(m, 004001, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04002  3323
+  CPU_COUNT(m, 004002, 03323);
+  COVERAGE_SET(m, 004002);
+  HISTORY_ADD(m, 004002, 03323, a, q);
+  cpma = 004123;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004000 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004003; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 04003  3324
+  CPU_COUNT(m, 004003, 03324);
+  COVERAGE_SET(m, 004003);
+  HISTORY_ADD(m, 004003, 03324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004000 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004004; *count = 4;
+    m->time += 9000;
+    return 0;
+  }
+
+  // 04004  1040
+  CPU_COUNT(m, 004004, 01040);
+  COVERAGE_SET(m, 004004);
+  HISTORY_ADD(m, 004004, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04005  3232
+  CPU_COUNT(m, 004005, 03232);
+  COVERAGE_SET(m, 004005);
+  HISTORY_ADD(m, 004005, 03232, a, q);
+  cpma = 004032;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004000 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004006; *count = 6;
+    m->time += 14200;
+    return 0;
+  }
+
+  // 04006  1110
+  CPU_COUNT(m, 004006, 01110);
+  COVERAGE_SET(m, 004006);
+  HISTORY_ADD(m, 004006, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04007  3327
+  CPU_COUNT(m, 004007, 03327);
+  COVERAGE_SET(m, 004007);
+  HISTORY_ADD(m, 004007, 03327, a, q);
+  cpma = 004127;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004000 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004010; *count = 8;
+    m->time += 19400;
+    return 0;
+  }
+
+  // 04010  1110
+  CPU_COUNT(m, 004010, 01110);
+  COVERAGE_SET(m, 004010);
+  HISTORY_ADD(m, 004010, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04011  3031
+  CPU_COUNT(m, 004011, 03031);
+  COVERAGE_SET(m, 004011);
+  HISTORY_ADD(m, 004011, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004000 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004012; *count = 10;
+    m->time += 24600;
+    return 0;
+  }
+
+  // 04012  1040
+  CPU_COUNT(m, 004012, 01040);
+  COVERAGE_SET(m, 004012);
+  HISTORY_ADD(m, 004012, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04013  3214
+  CPU_COUNT(m, 004013, 03214);
+  COVERAGE_SET(m, 004013);
+  HISTORY_ADD(m, 004013, 03214, a, q);
+  cpma = 004014;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 004014;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 29800;
+  *count = 12;
+  return res;
+}
+
+static int b04001(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004001] != 07300 ||
+      m->mem[004002] != 03323 || m->breakpoints[004002] ||
+      m->mem[004003] != 03324 || m->breakpoints[004003] ||
+      m->mem[004004] != 01040 || m->breakpoints[004004] ||
+      m->mem[004005] != 03232 || m->breakpoints[004005] ||
+      m->mem[004006] != 01110 || m->breakpoints[004006] ||
+      m->mem[004007] != 03327 || m->breakpoints[004007] ||
+      m->mem[004010] != 01110 || m->breakpoints[004010] ||
+      m->mem[004011] != 03031 || m->breakpoints[004011] ||
+      m->mem[004012] != 01040 || m->breakpoints[004012] ||
+      m->mem[004013] != 03214 || m->breakpoints[004013] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 11 || m->time + 24600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04001  7300
+  CPU_COUNT(m, 004001, 07300);
+  COVERAGE_SET(m, 004001);
+  HISTORY_ADD(m, 004001, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04002  3323
+  CPU_COUNT(m, 004002, 03323);
+  COVERAGE_SET(m, 004002);
+  HISTORY_ADD(m, 004002, 03323, a, q);
+  cpma = 004123;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004001 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004003; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 04003  3324
+  CPU_COUNT(m, 004003, 03324);
+  COVERAGE_SET(m, 004003);
+  HISTORY_ADD(m, 004003, 03324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004001 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004004; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 04004  1040
+  CPU_COUNT(m, 004004, 01040);
+  COVERAGE_SET(m, 004004);
+  HISTORY_ADD(m, 004004, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04005  3232
+  CPU_COUNT(m, 004005, 03232);
+  COVERAGE_SET(m, 004005);
+  HISTORY_ADD(m, 004005, 03232, a, q);
+  cpma = 004032;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004001 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004006; *count = 5;
+    m->time += 11600;
+    return 0;
+  }
+
+  // 04006  1110
+  CPU_COUNT(m, 004006, 01110);
+  COVERAGE_SET(m, 004006);
+  HISTORY_ADD(m, 004006, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04007  3327
+  CPU_COUNT(m, 004007, 03327);
+  COVERAGE_SET(m, 004007);
+  HISTORY_ADD(m, 004007, 03327, a, q);
+  cpma = 004127;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004001 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004010; *count = 7;
+    m->time += 16800;
+    return 0;
+  }
+
+  // 04010  1110
+  CPU_COUNT(m, 004010, 01110);
+  COVERAGE_SET(m, 004010);
+  HISTORY_ADD(m, 004010, 01110, a, q);
+  cpma = 000110;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04011  3031
+  CPU_COUNT(m, 004011, 03031);
+  COVERAGE_SET(m, 004011);
+  HISTORY_ADD(m, 004011, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004001 && cpma <= 004013 ){
+    m->ac = a; m->mq = q; m->pc = 004012; *count = 9;
+    m->time += 22000;
+    return 0;
+  }
+
+  // 04012  1040
+  CPU_COUNT(m, 004012, 01040);
+  COVERAGE_SET(m, 004012);
+  HISTORY_ADD(m, 004012, 01040, a, q);
+  cpma = 000040;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04013  3214
+  CPU_COUNT(m, 004013, 03214);
+  COVERAGE_SET(m, 004013);
+  HISTORY_ADD(m, 004013, 03214, a, q);
+  cpma = 004014;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 004014;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 27200;
+  *count = 11;
+  return res;
+}
+
+static int b04015(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004015] != 04307 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04015  4307
+  CPU_COUNT(m, 004015, 04307);
+  COVERAGE_SET(m, 004015);
+  HISTORY_ADD(m, 004015, 04307, a, q);
+  cpma = 004107;
+  m->pc = 004016;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04016(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004016] != 02031 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04016  2031
+  CPU_COUNT(m, 004016, 02031);
+  COVERAGE_SET(m, 004016);
+  HISTORY_ADD(m, 004016, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004020 : 004017;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04017(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004017] != 05222 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04017  5222
+  CPU_COUNT(m, 004017, 05222);
+  COVERAGE_SET(m, 004017);
+  HISTORY_ADD(m, 004017, 05222, a, q);
+  cpma = 004022;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04020(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004020] != 04252 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04020  4252
+  CPU_COUNT(m, 004020, 04252);
+  COVERAGE_SET(m, 004020);
+  HISTORY_ADD(m, 004020, 04252, a, q);
+  cpma = 004052;
+  m->pc = 004021;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04021(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004021] != 05227 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04021  5227
+  CPU_COUNT(m, 004021, 05227);
+  COVERAGE_SET(m, 004021);
+  HISTORY_ADD(m, 004021, 05227, a, q);
+  cpma = 004027;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04022(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004022] != 01045 ||
+      m->mem[004023] != 01214 || m->breakpoints[004023] ||
+      m->mem[004024] != 03214 || m->breakpoints[004024] ||
+      m->mem[004025] != 02324 || m->breakpoints[004025] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04022  1045
+  CPU_COUNT(m, 004022, 01045);
+  COVERAGE_SET(m, 004022);
+  HISTORY_ADD(m, 004022, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04023  1214
+  CPU_COUNT(m, 004023, 01214);
+  COVERAGE_SET(m, 004023);
+  HISTORY_ADD(m, 004023, 01214, a, q);
+  cpma = 004014;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04024  3214
+  CPU_COUNT(m, 004024, 03214);
+  COVERAGE_SET(m, 004024);
+  HISTORY_ADD(m, 004024, 03214, a, q);
+  cpma = 004014;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004022 && cpma <= 004025 ){
+    m->ac = a; m->mq = q; m->pc = 004025; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 04025  2324
+  CPU_COUNT(m, 004025, 02324);
+  COVERAGE_SET(m, 004025);
+  HISTORY_ADD(m, 004025, 02324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004027 : 004026;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b04026(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004026] != 05214 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04026  5214
+  CPU_COUNT(m, 004026, 05214);
+  COVERAGE_SET(m, 004026);
+  HISTORY_ADD(m, 004026, 05214, a, q);
+  cpma = 004014;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04027(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004027] != 07300 ||
+      m->mem[004030] != 01323 || m->breakpoints[004030] ||
+      m->mem[004031] != 03324 || m->breakpoints[004031] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04027  7300
+  CPU_COUNT(m, 004027, 07300);
+  COVERAGE_SET(m, 004027);
+  HISTORY_ADD(m, 004027, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04030  1323
+  CPU_COUNT(m, 004030, 01323);
+  COVERAGE_SET(m, 004030);
+  HISTORY_ADD(m, 004030, 01323, a, q);
+  cpma = 004123;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04031  3324
+  CPU_COUNT(m, 004031, 03324);
+  COVERAGE_SET(m, 004031);
+  HISTORY_ADD(m, 004031, 03324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 004032;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 6400;
+  *count = 3;
+  return res;
+}
+
+static int b04033(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004033] != 04307 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04033  4307
+  CPU_COUNT(m, 004033, 04307);
+  COVERAGE_SET(m, 004033);
+  HISTORY_ADD(m, 004033, 04307, a, q);
+  cpma = 004107;
+  m->pc = 004034;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04035(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004035] != 04252 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04035  4252
+  CPU_COUNT(m, 004035, 04252);
+  COVERAGE_SET(m, 004035);
+  HISTORY_ADD(m, 004035, 04252, a, q);
+  cpma = 004052;
+  m->pc = 004036;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(cpma);
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04036(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004036] != 07300 ||
+      m->mem[004037] != 01232 || m->breakpoints[004037] ||
+      m->mem[004040] != 01045 || m->breakpoints[004040] ||
+      m->mem[004041] != 03232 || m->breakpoints[004041] ||
+      m->mem[004042] != 02323 || m->breakpoints[004042] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04036  7300
+  CPU_COUNT(m, 004036, 07300);
+  COVERAGE_SET(m, 004036);
+  HISTORY_ADD(m, 004036, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04037  1232
+  CPU_COUNT(m, 004037, 01232);
+  COVERAGE_SET(m, 004037);
+  HISTORY_ADD(m, 004037, 01232, a, q);
+  cpma = 004032;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04040  1045
+  CPU_COUNT(m, 004040, 01045);
+  COVERAGE_SET(m, 004040);
+  HISTORY_ADD(m, 004040, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04041  3232
+  CPU_COUNT(m, 004041, 03232);
+  COVERAGE_SET(m, 004041);
+  HISTORY_ADD(m, 004041, 03232, a, q);
+  cpma = 004032;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004036 && cpma <= 004042 ){
+    m->ac = a; m->mq = q; m->pc = 004042; *count = 4;
+    m->time += 9000;
+    return 0;
+  }
+
+  // 04042  2323
+  CPU_COUNT(m, 004042, 02323);
+  COVERAGE_SET(m, 004042);
+  HISTORY_ADD(m, 004042, 02323, a, q);
+  cpma = 004123;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004044 : 004043;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b04043(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004043] != 02327 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04043  2327
+  CPU_COUNT(m, 004043, 02327);
+  COVERAGE_SET(m, 004043);
+  HISTORY_ADD(m, 004043, 02327, a, q);
+  cpma = 004127;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004045 : 004044;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04044(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004044] != 05227 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04044  5227
+  CPU_COUNT(m, 004044, 05227);
+  COVERAGE_SET(m, 004044);
+  HISTORY_ADD(m, 004044, 05227, a, q);
+  cpma = 004027;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04047(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004047] != 02027 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04047  2027
+  CPU_COUNT(m, 004047, 02027);
+  COVERAGE_SET(m, 004047);
+  HISTORY_ADD(m, 004047, 02027, a, q);
+  cpma = 000027;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004051 : 004050;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04050(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004050] != 05201 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04050  5201
+  CPU_COUNT(m, 004050, 05201);
+  COVERAGE_SET(m, 004050);
+  HISTORY_ADD(m, 004050, 05201, a, q);
+  cpma = 004001;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04051(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004051] != 05600 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04051  5600
+  CPU_COUNT(m, 004051, 05600);
+  COVERAGE_SET(m, 004051);
+  HISTORY_ADD(m, 004051, 05600, a, q);
+  cpma = 000000 | (m->mem[004000] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b04053(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[004053] != 07300 ||
+      m->mem[004054] != 03324 || m->breakpoints[004054] ||
+      m->mem[004055] != 07604 || m->breakpoints[004055] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04053  7300
+  CPU_COUNT(m, 004053, 07300);
+  COVERAGE_SET(m, 004053);
+  HISTORY_ADD(m, 004053, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04054  3324
+  CPU_COUNT(m, 004054, 03324);
+  COVERAGE_SET(m, 004054);
+  HISTORY_ADD(m, 004054, 03324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004053 && cpma <= 004055 ){
+    m->ac = a; m->mq = q; m->pc = 004055; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 04055  7604
+  CPU_COUNT(m, 004055, 07604);
+  COVERAGE_SET(m, 004055);
+  HISTORY_ADD(m, 004055, 07604, a, q);
+  cond = 0;
+  a &= LINK_MASK;
+  m->pc = cond ? 004057 : 004056;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    a |= m->sr;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b04056(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004056] != 00044 ||
+      m->mem[004057] != 07040 || m->breakpoints[004057] ||
+      m->mem[004060] != 03031 || m->breakpoints[004060] ||
+      m->mem[004061] != 01041 || m->breakpoints[004061] ||
+      m->mem[004062] != 03263 || m->breakpoints[004062] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 9000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04056  0044
+  CPU_COUNT(m, 004056, 00044);
+  COVERAGE_SET(m, 004056);
+  HISTORY_ADD(m, 004056, 00044, a, q);
+  cpma = 000044;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 04057  7040
+  CPU_COUNT(m, 004057, 07040);
+  COVERAGE_SET(m, 004057);
+  HISTORY_ADD(m, 004057, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 04060  3031
+  CPU_COUNT(m, 004060, 03031);
+  COVERAGE_SET(m, 004060);
+  HISTORY_ADD(m, 004060, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004056 && cpma <= 004062 ){
+    m->ac = a; m->mq = q; m->pc = 004061; *count = 3;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 04061  1041
+  CPU_COUNT(m, 004061, 01041);
+  COVERAGE_SET(m, 004061);
+  HISTORY_ADD(m, 004061, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04062  3263
+  CPU_COUNT(m, 004062, 03263);
+  COVERAGE_SET(m, 004062);
+  HISTORY_ADD(m, 004062, 03263, a, q);
+  cpma = 004063;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 004063;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b04057(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004057] != 07040 ||
+      m->mem[004060] != 03031 || m->breakpoints[004060] ||
+      m->mem[004061] != 01041 || m->breakpoints[004061] ||
+      m->mem[004062] != 03263 || m->breakpoints[004062] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 6400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04057  7040
+  CPU_COUNT(m, 004057, 07040);
+  COVERAGE_SET(m, 004057);
+  HISTORY_ADD(m, 004057, 07040, a, q);
+  a ^= AC_MASK;
+
+  // 04060  3031
+  CPU_COUNT(m, 004060, 03031);
+  COVERAGE_SET(m, 004060);
+  HISTORY_ADD(m, 004060, 03031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004057 && cpma <= 004062 ){
+    m->ac = a; m->mq = q; m->pc = 004061; *count = 2;
+    m->time += 3800;
+    return 0;
+  }
+
+  // 04061  1041
+  CPU_COUNT(m, 004061, 01041);
+  COVERAGE_SET(m, 004061);
+  HISTORY_ADD(m, 004061, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04062  3263
+  CPU_COUNT(m, 004062, 03263);
+  COVERAGE_SET(m, 004062);
+  HISTORY_ADD(m, 004062, 03263, a, q);
+  cpma = 004063;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  m->pc = 004063;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 9000;
+  *count = 4;
+  return res;
+}
+
+static int b04064(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004064] != 05541 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04064  5541
+  CPU_COUNT(m, 004064, 05541);
+  COVERAGE_SET(m, 004064);
+  HISTORY_ADD(m, 004064, 05541, a, q);
+  cpma = 000000 | (m->mem[000141] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b04065(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[004065] != 07041 ||
+      m->mem[004066] != 01324 || m->breakpoints[004066] ||
+      m->mem[004067] != 07450 || m->breakpoints[004067] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 3 || m->time + 3800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04065  7041
+  CPU_COUNT(m, 004065, 07041);
+  COVERAGE_SET(m, 004065);
+  HISTORY_ADD(m, 004065, 07041, a, q);
+  a ^= AC_MASK;
+  a = (a + 1) & LINK_AC_MASK;
+
+  // 04066  1324
+  CPU_COUNT(m, 004066, 01324);
+  COVERAGE_SET(m, 004066);
+  HISTORY_ADD(m, 004066, 01324, a, q);
+  cpma = 004124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04067  7450
+  CPU_COUNT(m, 004067, 07450);
+  COVERAGE_SET(m, 004067);
+  HISTORY_ADD(m, 004067, 07450, a, q);
+  cond = 0 || ! (a & AC_MASK);
+  m->pc = ! cond ? 004071 : 004070;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 5000;
+  *count = 3;
+  return res;
+}
+
+static int b04070(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004070] != 05276 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04070  5276
+  CPU_COUNT(m, 004070, 05276);
+  COVERAGE_SET(m, 004070);
+  HISTORY_ADD(m, 004070, 05276, a, q);
+  cpma = 004076;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04071(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  char cond;
+  int res = 0;
+
+  if( m->mem[004071] != 03112 ||
+      m->mem[004072] != 01263 || m->breakpoints[004072] ||
+      m->mem[004073] != 00111 || m->breakpoints[004073] ||
+      m->mem[004074] != 01112 || m->breakpoints[004074] ||
+      m->mem[004075] != 07402 || m->breakpoints[004075] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 5 || m->time + 10400 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04071  3112
+  CPU_COUNT(m, 004071, 03112);
+  COVERAGE_SET(m, 004071);
+  HISTORY_ADD(m, 004071, 03112, a, q);
+  cpma = 000112;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004071 && cpma <= 004075 ){
+    m->ac = a; m->mq = q; m->pc = 004072; *count = 1;
+    m->time += 2600;
+    return 0;
+  }
+
+  // 04072  1263
+  CPU_COUNT(m, 004072, 01263);
+  COVERAGE_SET(m, 004072);
+  HISTORY_ADD(m, 004072, 01263, a, q);
+  cpma = 004063;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04073  0111
+  CPU_COUNT(m, 004073, 00111);
+  COVERAGE_SET(m, 004073);
+  HISTORY_ADD(m, 004073, 00111, a, q);
+  cpma = 000111;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 04074  1112
+  CPU_COUNT(m, 004074, 01112);
+  COVERAGE_SET(m, 004074);
+  HISTORY_ADD(m, 004074, 01112, a, q);
+  cpma = 000112;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04075  7402
+  CPU_COUNT(m, 004075, 07402);
+  COVERAGE_SET(m, 004075);
+  HISTORY_ADD(m, 004075, 07402, a, q);
+  cond = 0;
+  m->pc = cond ? 004077 : 004076;
+  if( m->uf ){
+    m->intr |= UINTR_FLAG;
+  } else {
+    res = -1;
+  }
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 11600;
+  *count = 5;
+  return res;
+}
+
+static int b04076(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004076] != 07300 ||
+      m->mem[004077] != 02031 || m->breakpoints[004077] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 2 || m->time + 1200 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04076  7300
+  CPU_COUNT(m, 004076, 07300);
+  COVERAGE_SET(m, 004076);
+  HISTORY_ADD(m, 004076, 07300, a, q);
+  a &= LINK_MASK;
+  a &= AC_MASK;
+
+  // 04077  2031
+  CPU_COUNT(m, 004077, 02031);
+  COVERAGE_SET(m, 004077);
+  HISTORY_ADD(m, 004077, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004101 : 004100;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 3800;
+  *count = 2;
+  return res;
+}
+
+static int b04077(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004077] != 02031 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04077  2031
+  CPU_COUNT(m, 004077, 02031);
+  COVERAGE_SET(m, 004077);
+  HISTORY_ADD(m, 004077, 02031, a, q);
+  cpma = 000031;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004101 : 004100;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2600;
+  *count = 1;
+  return res;
+}
+
+static int b04100(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  char cond;
+  int res = 0;
+
+  if( m->mem[004100] != 07410 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04100  7410
+  CPU_COUNT(m, 004100, 07410);
+  COVERAGE_SET(m, 004100);
+  HISTORY_ADD(m, 004100, 07410, a, q);
+  cond = 0;
+  m->pc = ! cond ? 004102 : 004101;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04101(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004101] != 05652 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04101  5652
+  CPU_COUNT(m, 004101, 05652);
+  COVERAGE_SET(m, 004101);
+  HISTORY_ADD(m, 004101, 05652, a, q);
+  cpma = 000000 | (m->mem[004052] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 2400;
+  *count = 1;
+  return res;
+}
+
+static int b04102(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004102] != 01263 ||
+      m->mem[004103] != 01045 || m->breakpoints[004103] ||
+      m->mem[004104] != 03263 || m->breakpoints[004104] ||
+      m->mem[004105] != 02324 || m->breakpoints[004105] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 4 || m->time + 7800 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04102  1263
+  CPU_COUNT(m, 004102, 01263);
+  COVERAGE_SET(m, 004102);
+  HISTORY_ADD(m, 004102, 01263, a, q);
+  cpma = 004063;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04103  1045
+  CPU_COUNT(m, 004103, 01045);
+  COVERAGE_SET(m, 004103);
+  HISTORY_ADD(m, 004103, 01045, a, q);
+  cpma = 000045;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04104  3263
+  CPU_COUNT(m, 004104, 03263);
+  COVERAGE_SET(m, 004104);
+  HISTORY_ADD(m, 004104, 03263, a, q);
+  cpma = 004063;
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004102 && cpma <= 004105 ){
+    m->ac = a; m->mq = q; m->pc = 004105; *count = 3;
+    m->time += 7800;
+    return 0;
+  }
+
+  // 04105  2324
+  CPU_COUNT(m, 004105, 02324);
+  COVERAGE_SET(m, 004105);
+  HISTORY_ADD(m, 004105, 02324, a, q);
+  cpma = 004124;
+  cpu_store_mem(m, cpma, INC_12BIT(m->mem[cpma]));
+  m->pc = m->mem[cpma] == 0 ? 004107 : 004106;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 10400;
+  *count = 4;
+  return res;
+}
+
+static int b04106(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004106] != 05263 ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 1 || m->time + 0 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04106  5263
+  CPU_COUNT(m, 004106, 05263);
+  COVERAGE_SET(m, 004106);
+  HISTORY_ADD(m, 004106, 05263, a, q);
+  cpma = 004063;
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 1200;
+  *count = 1;
+  return res;
+}
+
+static int b04107(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004107] != 00000 ||
+      m->mem[004110] != 01324 || m->breakpoints[004110] ||
+      m->mem[004111] != 03537 || m->breakpoints[004111] ||
+      m->mem[004112] != 01130 || m->breakpoints[004112] ||
+      m->mem[004113] != 03541 || m->breakpoints[004113] ||
+      m->mem[004114] != 01041 || m->breakpoints[004114] ||
+      m->mem[004115] != 03522 || m->breakpoints[004115] ||
+      m->mem[004116] != 01326 || m->breakpoints[004116] ||
+      m->mem[004117] != 03540 || m->breakpoints[004117] ||
+      m->mem[004120] != 01325 || m->breakpoints[004120] ||
+      m->mem[004121] != 03523 || m->breakpoints[004121] ||
+      m->mem[004122] != 05707 || m->breakpoints[004122] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 12 || m->time + 34600 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04107  0000
+  CPU_COUNT(m, 004107, 00000);
+  COVERAGE_SET(m, 004107);
+  HISTORY_ADD(m, 004107, 00000, a, q);
+  cpma = 000000;
+  a &= (m->mem[cpma] | LINK_MASK);
+
+  // 04110  1324
+  CPU_COUNT(m, 004110, 01324);
+  COVERAGE_SET(m, 004110);
+  HISTORY_ADD(m, 004110, 01324, a, q);
+  cpma = 004124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04111  3537
+  CPU_COUNT(m, 004111, 03537);
+  COVERAGE_SET(m, 004111);
+  HISTORY_ADD(m, 004111, 03537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004107 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004112; *count = 3;
+    m->time += 9000;
+    return 0;
+  }
+
+  // 04112  1130
+  CPU_COUNT(m, 004112, 01130);
+  COVERAGE_SET(m, 004112);
+  HISTORY_ADD(m, 004112, 01130, a, q);
+  cpma = 000130;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04113  3541
+  CPU_COUNT(m, 004113, 03541);
+  COVERAGE_SET(m, 004113);
+  HISTORY_ADD(m, 004113, 03541, a, q);
+  cpma = m->df_base | (m->mem[000141] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004107 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004114; *count = 5;
+    m->time += 15400;
+    return 0;
+  }
+
+  // 04114  1041
+  CPU_COUNT(m, 004114, 01041);
+  COVERAGE_SET(m, 004114);
+  HISTORY_ADD(m, 004114, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04115  3522
+  CPU_COUNT(m, 004115, 03522);
+  COVERAGE_SET(m, 004115);
+  HISTORY_ADD(m, 004115, 03522, a, q);
+  cpma = m->df_base | (m->mem[000122] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004107 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004116; *count = 7;
+    m->time += 21800;
+    return 0;
+  }
+
+  // 04116  1326
+  CPU_COUNT(m, 004116, 01326);
+  COVERAGE_SET(m, 004116);
+  HISTORY_ADD(m, 004116, 01326, a, q);
+  cpma = 004126;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04117  3540
+  CPU_COUNT(m, 004117, 03540);
+  COVERAGE_SET(m, 004117);
+  HISTORY_ADD(m, 004117, 03540, a, q);
+  cpma = m->df_base | (m->mem[000140] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004107 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004120; *count = 9;
+    m->time += 28200;
+    return 0;
+  }
+
+  // 04120  1325
+  CPU_COUNT(m, 004120, 01325);
+  COVERAGE_SET(m, 004120);
+  HISTORY_ADD(m, 004120, 01325, a, q);
+  cpma = 004125;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04121  3523
+  CPU_COUNT(m, 004121, 03523);
+  COVERAGE_SET(m, 004121);
+  HISTORY_ADD(m, 004121, 03523, a, q);
+  cpma = m->df_base | (m->mem[000123] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004107 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004122; *count = 11;
+    m->time += 34600;
+    return 0;
+  }
+
+  // 04122  5707
+  CPU_COUNT(m, 004122, 05707);
+  COVERAGE_SET(m, 004122);
+  HISTORY_ADD(m, 004122, 05707, a, q);
+  cpma = 000000 | (m->mem[004107] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 37000;
+  *count = 12;
+  return res;
+}
+
+static int b04110(pdp8_machine_t *m, int *count)
+{
+  short a = m->ac, q = m->mq;
+  short cpma;
+  int res = 0;
+
+  if( m->mem[004110] != 01324 ||
+      m->mem[004111] != 03537 || m->breakpoints[004111] ||
+      m->mem[004112] != 01130 || m->breakpoints[004112] ||
+      m->mem[004113] != 03541 || m->breakpoints[004113] ||
+      m->mem[004114] != 01041 || m->breakpoints[004114] ||
+      m->mem[004115] != 03522 || m->breakpoints[004115] ||
+      m->mem[004116] != 01326 || m->breakpoints[004116] ||
+      m->mem[004117] != 03540 || m->breakpoints[004117] ||
+      m->mem[004120] != 01325 || m->breakpoints[004120] ||
+      m->mem[004121] != 03523 || m->breakpoints[004121] ||
+      m->mem[004122] != 05707 || m->breakpoints[004122] ){
+    *count = 0;
+    return 0;
+  }
+  if( *count < 11 || m->time + 32000 >= m->deadline ){
+    *count = 0;
+    return 0;
+  }
+
+  // 04110  1324
+  CPU_COUNT(m, 004110, 01324);
+  COVERAGE_SET(m, 004110);
+  HISTORY_ADD(m, 004110, 01324, a, q);
+  cpma = 004124;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04111  3537
+  CPU_COUNT(m, 004111, 03537);
+  COVERAGE_SET(m, 004111);
+  HISTORY_ADD(m, 004111, 03537, a, q);
+  cpma = m->df_base | (m->mem[000137] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004110 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004112; *count = 2;
+    m->time += 6400;
+    return 0;
+  }
+
+  // 04112  1130
+  CPU_COUNT(m, 004112, 01130);
+  COVERAGE_SET(m, 004112);
+  HISTORY_ADD(m, 004112, 01130, a, q);
+  cpma = 000130;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04113  3541
+  CPU_COUNT(m, 004113, 03541);
+  COVERAGE_SET(m, 004113);
+  HISTORY_ADD(m, 004113, 03541, a, q);
+  cpma = m->df_base | (m->mem[000141] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004110 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004114; *count = 4;
+    m->time += 12800;
+    return 0;
+  }
+
+  // 04114  1041
+  CPU_COUNT(m, 004114, 01041);
+  COVERAGE_SET(m, 004114);
+  HISTORY_ADD(m, 004114, 01041, a, q);
+  cpma = 000041;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04115  3522
+  CPU_COUNT(m, 004115, 03522);
+  COVERAGE_SET(m, 004115);
+  HISTORY_ADD(m, 004115, 03522, a, q);
+  cpma = m->df_base | (m->mem[000122] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004110 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004116; *count = 6;
+    m->time += 19200;
+    return 0;
+  }
+
+  // 04116  1326
+  CPU_COUNT(m, 004116, 01326);
+  COVERAGE_SET(m, 004116);
+  HISTORY_ADD(m, 004116, 01326, a, q);
+  cpma = 004126;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04117  3540
+  CPU_COUNT(m, 004117, 03540);
+  COVERAGE_SET(m, 004117);
+  HISTORY_ADD(m, 004117, 03540, a, q);
+  cpma = m->df_base | (m->mem[000140] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004110 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004120; *count = 8;
+    m->time += 25600;
+    return 0;
+  }
+
+  // 04120  1325
+  CPU_COUNT(m, 004120, 01325);
+  COVERAGE_SET(m, 004120);
+  HISTORY_ADD(m, 004120, 01325, a, q);
+  cpma = 004125;
+  a = (a + m->mem[cpma]) & LINK_AC_MASK;
+
+  // 04121  3523
+  CPU_COUNT(m, 004121, 03523);
+  COVERAGE_SET(m, 004121);
+  HISTORY_ADD(m, 004121, 03523, a, q);
+  cpma = m->df_base | (m->mem[000123] & B12_MASK);
+  cpu_store_mem(m, cpma, a & AC_MASK);
+  a &= LINK_MASK;
+  if( cpma >= 004110 && cpma <= 004122 ){
+    m->ac = a; m->mq = q; m->pc = 004122; *count = 10;
+    m->time += 32000;
+    return 0;
+  }
+
+  // 04122  5707
+  CPU_COUNT(m, 004122, 05707);
+  COVERAGE_SET(m, 004122);
+  HISTORY_ADD(m, 004122, 05707, a, q);
+  cpma = 000000 | (m->mem[004107] & B12_MASK);
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    cpma = m->if_base | (cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = cpma;
+
+  m->ac = a;
+  m->mq = q;
+  m->time += 34400;
+  *count = 11;
+  return res;
+}
+
+static const aot_block_fn page000[0200] = {
+  [0000] = b00000,
+  [0001] = b00001,
+};
+
+static const aot_block_fn page001[0200] = {
+  [0000] = b00200,
+  [0001] = b00201,
+  [0002] = b00202,
+  [0003] = b00203,
+  [0006] = b00206,
+  [0007] = b00207,
+  [0013] = b00213,
+  [0014] = b00214,
+  [0015] = b00215,
+  [0016] = b00216,
+  [0017] = b00217,
+  [0020] = b00220,
+  [0023] = b00223,
+  [0024] = b00224,
+  [0025] = b00225,
+  [0026] = b00226,
+  [0027] = b00227,
+  [0030] = b00230,
+  [0031] = b00231,
+  [0032] = b00232,
+  [0033] = b00233,
+  [0035] = b00235,
+  [0040] = b00240,
+  [0041] = b00241,
+  [0042] = b00242,
+  [0043] = b00243,
+  [0044] = b00244,
+  [0045] = b00245,
+  [0046] = b00246,
+  [0051] = b00251,
+  [0052] = b00252,
+  [0053] = b00253,
+  [0054] = b00254,
+  [0055] = b00255,
+  [0056] = b00256,
+  [0057] = b00257,
+  [0060] = b00260,
+  [0061] = b00261,
+  [0063] = b00263,
+  [0066] = b00266,
+  [0067] = b00267,
+  [0070] = b00270,
+  [0071] = b00271,
+  [0072] = b00272,
+  [0073] = b00273,
+  [0074] = b00274,
+  [0077] = b00277,
+  [0100] = b00300,
+  [0101] = b00301,
+  [0102] = b00302,
+  [0103] = b00303,
+  [0104] = b00304,
+  [0105] = b00305,
+  [0106] = b00306,
+  [0107] = b00307,
+  [0111] = b00311,
+  [0114] = b00314,
+  [0115] = b00315,
+  [0116] = b00316,
+  [0117] = b00317,
+  [0120] = b00320,
+  [0121] = b00321,
+  [0122] = b00322,
+  [0125] = b00325,
+  [0126] = b00326,
+  [0127] = b00327,
+  [0130] = b00330,
+  [0131] = b00331,
+  [0132] = b00332,
+  [0133] = b00333,
+  [0134] = b00334,
+  [0136] = b00336,
+  [0140] = b00340,
+  [0141] = b00341,
+  [0144] = b00344,
+  [0146] = b00346,
+  [0150] = b00350,
+  [0151] = b00351,
+  [0152] = b00352,
+  [0153] = b00353,
+  [0156] = b00356,
+  [0160] = b00360,
+  [0161] = b00361,
+  [0162] = b00362,
+  [0163] = b00363,
+  [0164] = b00364,
+  [0166] = b00366,
+  [0167] = b00367,
+  [0170] = b00370,
+  [0171] = b00371,
+  [0172] = b00372,
+  [0173] = b00373,
+  [0174] = b00374,
+  [0175] = b00375,
+};
+
+static const aot_block_fn page002[0200] = {
+  [0000] = b00400,
+  [0004] = b00404,
+  [0006] = b00406,
+  [0007] = b00407,
+  [0010] = b00410,
+  [0011] = b00411,
+  [0012] = b00412,
+  [0014] = b00414,
+  [0015] = b00415,
+  [0016] = b00416,
+  [0017] = b00417,
+  [0020] = b00420,
+  [0023] = b00423,
+  [0025] = b00425,
+  [0026] = b00426,
+  [0027] = b00427,
+  [0030] = b00430,
+  [0031] = b00431,
+  [0033] = b00433,
+  [0034] = b00434,
+  [0035] = b00435,
+  [0036] = b00436,
+  [0037] = b00437,
+  [0040] = b00440,
+  [0041] = b00441,
+  [0042] = b00442,
+  [0046] = b00446,
+  [0050] = b00450,
+  [0051] = b00451,
+  [0052] = b00452,
+  [0053] = b00453,
+  [0054] = b00454,
+  [0056] = b00456,
+  [0057] = b00457,
+  [0060] = b00460,
+  [0061] = b00461,
+  [0062] = b00462,
+  [0065] = b00465,
+  [0067] = b00467,
+  [0070] = b00470,
+  [0071] = b00471,
+  [0072] = b00472,
+  [0073] = b00473,
+  [0075] = b00475,
+  [0076] = b00476,
+  [0077] = b00477,
+  [0100] = b00500,
+  [0101] = b00501,
+  [0102] = b00502,
+  [0103] = b00503,
+  [0104] = b00504,
+  [0110] = b00510,
+  [0112] = b00512,
+  [0113] = b00513,
+  [0114] = b00514,
+  [0115] = b00515,
+  [0116] = b00516,
+  [0120] = b00520,
+  [0121] = b00521,
+  [0122] = b00522,
+  [0123] = b00523,
+  [0124] = b00524,
+  [0127] = b00527,
+  [0131] = b00531,
+  [0132] = b00532,
+  [0133] = b00533,
+  [0134] = b00534,
+  [0135] = b00535,
+  [0137] = b00537,
+  [0140] = b00540,
+  [0141] = b00541,
+  [0142] = b00542,
+  [0143] = b00543,
+  [0144] = b00544,
+  [0145] = b00545,
+  [0146] = b00546,
+};
+
+static const aot_block_fn page003[0200] = {
+  [0000] = b00600,
+  [0001] = b00601,
+  [0002] = b00602,
+  [0010] = b00610,
+  [0011] = b00611,
+  [0013] = b00613,
+  [0014] = b00614,
+  [0015] = b00615,
+  [0021] = b00621,
+  [0022] = b00622,
+  [0023] = b00623,
+  [0031] = b00631,
+  [0032] = b00632,
+  [0037] = b00637,
+  [0040] = b00640,
+  [0041] = b00641,
+  [0042] = b00642,
+  [0043] = b00643,
+  [0044] = b00644,
+  [0045] = b00645,
+  [0051] = b00651,
+  [0052] = b00652,
+  [0054] = b00654,
+  [0055] = b00655,
+  [0057] = b00657,
+  [0060] = b00660,
+  [0066] = b00666,
+  [0067] = b00667,
+  [0072] = b00672,
+  [0073] = b00673,
+  [0101] = b00701,
+  [0102] = b00702,
+  [0103] = b00703,
+  [0107] = b00707,
+  [0110] = b00710,
+  [0111] = b00711,
+  [0115] = b00715,
+  [0125] = b00725,
+  [0126] = b00726,
+  [0127] = b00727,
+  [0131] = b00731,
+  [0132] = b00732,
+  [0134] = b00734,
+  [0135] = b00735,
+  [0141] = b00741,
+  [0142] = b00742,
+  [0143] = b00743,
+  [0144] = b00744,
+  [0145] = b00745,
+  [0146] = b00746,
+  [0147] = b00747,
+  [0150] = b00750,
+};
+
+static const aot_block_fn page004[0200] = {
+  [0000] = b01000,
+  [0003] = b01003,
+  [0004] = b01004,
+  [0005] = b01005,
+  [0011] = b01011,
+  [0021] = b01021,
+  [0022] = b01022,
+  [0023] = b01023,
+  [0024] = b01024,
+  [0026] = b01026,
+  [0027] = b01027,
+  [0031] = b01031,
+  [0032] = b01032,
+  [0036] = b01036,
+  [0037] = b01037,
+  [0040] = b01040,
+  [0041] = b01041,
+  [0042] = b01042,
+  [0043] = b01043,
+  [0044] = b01044,
+  [0045] = b01045,
+};
+
+static const aot_block_fn page010[0200] = {
+  [0050] = b02050,
+  [0052] = b02052,
+  [0055] = b02055,
+  [0060] = b02060,
+  [0061] = b02061,
+  [0064] = b02064,
+  [0066] = b02066,
+  [0067] = b02067,
+  [0070] = b02070,
+  [0075] = b02075,
+  [0076] = b02076,
+  [0077] = b02077,
+  [0110] = b02110,
+  [0111] = b02111,
+  [0113] = b02113,
+  [0120] = b02120,
+  [0121] = b02121,
+  [0122] = b02122,
+  [0125] = b02125,
+  [0126] = b02126,
+};
+
+static const aot_block_fn page011[0200] = {
+  [0071] = b02271,
+  [0076] = b02276,
+  [0106] = b02306,
+  [0110] = b02310,
+  [0112] = b02312,
+  [0113] = b02313,
+  [0115] = b02315,
+  [0116] = b02316,
+  [0117] = b02317,
+  [0120] = b02320,
+  [0124] = b02324,
+  [0125] = b02325,
+  [0131] = b02331,
+  [0137] = b02337,
+  [0140] = b02340,
+  [0141] = b02341,
+  [0142] = b02342,
+  [0144] = b02344,
+  [0146] = b02346,
+  [0147] = b02347,
+  [0151] = b02351,
+  [0152] = b02352,
+  [0154] = b02354,
+  [0156] = b02356,
+  [0157] = b02357,
+  [0161] = b02361,
+  [0162] = b02362,
+  [0163] = b02363,
+  [0164] = b02364,
+  [0165] = b02365,
+  [0166] = b02366,
+  [0167] = b02367,
+  [0170] = b02370,
+  [0171] = b02371,
+};
+
+static const aot_block_fn page012[0200] = {
+  [0000] = b02400,
+  [0002] = b02402,
+  [0007] = b02407,
+  [0011] = b02411,
+  [0012] = b02412,
+  [0013] = b02413,
+  [0015] = b02415,
+  [0016] = b02416,
+  [0021] = b02421,
+  [0022] = b02422,
+  [0023] = b02423,
+  [0024] = b02424,
+  [0030] = b02430,
+  [0031] = b02431,
+  [0036] = b02436,
+  [0037] = b02437,
+  [0040] = b02440,
+  [0044] = b02444,
+  [0047] = b02447,
+  [0050] = b02450,
+  [0052] = b02452,
+  [0054] = b02454,
+  [0065] = b02465,
+  [0066] = b02466,
+  [0067] = b02467,
+  [0070] = b02470,
+};
+
+static const aot_block_fn page017[0200] = {
+  [0043] = b03643,
+  [0050] = b03650,
+  [0051] = b03651,
+  [0053] = b03653,
+  [0054] = b03654,
+  [0057] = b03657,
+};
+
+static const aot_block_fn page020[0200] = {
+  [0000] = b04000,
+  [0001] = b04001,
+  [0015] = b04015,
+  [0016] = b04016,
+  [0017] = b04017,
+  [0020] = b04020,
+  [0021] = b04021,
+  [0022] = b04022,
+  [0026] = b04026,
+  [0027] = b04027,
+  [0033] = b04033,
+  [0035] = b04035,
+  [0036] = b04036,
+  [0043] = b04043,
+  [0044] = b04044,
+  [0047] = b04047,
+  [0050] = b04050,
+  [0051] = b04051,
+  [0053] = b04053,
+  [0056] = b04056,
+  [0057] = b04057,
+  [0064] = b04064,
+  [0065] = b04065,
+  [0070] = b04070,
+  [0071] = b04071,
+  [0076] = b04076,
+  [0077] = b04077,
+  [0100] = b04100,
+  [0101] = b04101,
+  [0102] = b04102,
+  [0106] = b04106,
+  [0107] = b04107,
+  [0110] = b04110,
+};
+
+const aot_block_fn * const aot_pages[PAGES] = {
+  [0000] = page000,
+  [0001] = page001,
+  [0002] = page002,
+  [0003] = page003,
+  [0004] = page004,
+  [0010] = page010,
+  [0011] = page011,
+  [0012] = page012,
+  [0017] = page017,
+  [0020] = page020,
+};
@@ -0,0 +1,710 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+// Batch engine. Runs many copies of one machine, e.g. one per switch
+// register setting in a parameter sweep. AC, PC, MQ, SR and the time
+// of all lanes are kept in structure of arrays layout and BATCH_WIDTH
+// lanes are stepped together. Lanes that execute the same instruction
+// word at the same address share its fetch, decode and timing. Group
+// one, two and three OPRs run as vector operations, MRIs and IOTs one
+// lane at a time since memory and devices are private to each lane.
+// Lanes do not record their PC history.
+//
+// Lanes that execute a HLT or EAE instruction, or have interrupt,
+// field or user mode state pending take the step through
+// cpu_process() instead. A lane that diverges from the others splits
+// off and runs on its own with cpu_run(). With verify set every lane
+// is run again on a reference machine with cpu_process() alone, which
+// must end in the same state with the same registers and memory.
+
+#define _POSIX_C_SOURCE 200112L
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cpu.h"
+#include "tty.h"
+#include "pdp8.h"
+#include "batch.h"
+#include "machine.h"
+
+#define BATCH_WIDTH 16 // 16 lanes of 16 bits, one AVX2 register
+// With fewer lanes left in a vector the remaining lanes run faster on
+// their own.
+#define BATCH_MIN_LOCKSTEP 4
+
+// The machines of the lanes are laid out one cache line further from
+// a page boundary each. Machines from cpu_create() all start at the
+// same offset in a page, the same words of every lane would compete
+// for one set of the L1 cache.
+#define LANE_STRIDE \
+  ((sizeof(pdp8_machine_t) + 4095) / 4096 * 4096 + 64)
+
+#ifdef __GNUC__
+typedef short vec_t __attribute__((vector_size(BATCH_WIDTH * sizeof(short))));
+#endif
+
+struct batch {
+  int lanes;
+  int width; // lanes rounded up to a multiple of BATCH_WIDTH
+  char verify;
+  pdp8_machine_t **m;   // Memory and all other state of each lane
+  char *slab; // The machines of all lanes, see batch_create()
+  pdp8_machine_t **ref; // Reference machines when verifying
+  // Registers and time in structure of arrays layout, only valid
+  // inside batch_run().
+  short *ac;
+  short *pc;
+  short *mq;
+  short *sr;
+  unsigned long long *time;
+  int *slack; // Time left to the next event, at most INT_MAX
+  short **mem; // Padding lanes read the memory of lane 0
+  short *scalar; // -1 if the lane must step through cpu_process()
+  short *live;   // -1 if the lane is running
+  short *breakpoints; // Shared, lanes never change their breakpoints
+  char stop_checks;   // Any breakpoint or stop_at is set
+  char *state;
+  long *executed;
+};
+
+
+static void *alloc_lanes(int width, size_t size)
+{
+  void *p = NULL;
+
+  if( posix_memalign(&p, 64, width * size) ){
+    return NULL;
+  }
+  memset(p, 0, width * size);
+  return p;
+}
+
+
+// Make dst a copy of src, keeping the engine cache of dst. The copy
+// has no console, its keyboard is never polled and its TTY output is
+// thrown away.
+static void clone(pdp8_machine_t *dst, pdp8_machine_t *src)
+{
+  struct cpu_cache *cache = dst->cache;
+
+  memcpy(dst, src, sizeof(pdp8_machine_t));
+  dst->cache = cache;
+  dst->attention = 0;
+  dst->tty.connected = 0;
+  event_cancel(dst, tty_process);
+  event_cancel(dst, prof_tick);
+  memset(&dst->prof, 0, sizeof(prof_t)); // The samples belong to src
+  memset(&dst->trace, 0, sizeof(trace_t)); // And so does the trace file
+  dst->trace.fd = -1;
+  dst->watching = 0; // Lanes do not stop for watches
+  for( int i = 0; i < MEMSIZE; i++ ){
+    cpu_store_mem(dst, i, src->mem[i]);
+  }
+}
+
+
+// Create a batch of lanes copies of m. Returns NULL if out of memory.
+batch_t *batch_create(pdp8_machine_t *m, int lanes, char verify)
+{
+  batch_t *b = calloc(1, sizeof(batch_t));
+
+  if( b == NULL ){
+    return NULL;
+  }
+  b->lanes = lanes;
+  b->width = (lanes + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+  b->verify = verify;
+  b->m = calloc(b->width, sizeof(pdp8_machine_t *));
+  b->slab = alloc_lanes(lanes, LANE_STRIDE);
+  b->ref = calloc(b->width, sizeof(pdp8_machine_t *));
+  b->ac = alloc_lanes(b->width, sizeof(short));
+  b->pc = alloc_lanes(b->width, sizeof(short));
+  b->mq = alloc_lanes(b->width, sizeof(short));
+  b->sr = alloc_lanes(b->width, sizeof(short));
+  b->time = alloc_lanes(b->width, sizeof(unsigned long long));
+  b->slack = alloc_lanes(b->width, sizeof(int));
+  b->mem = alloc_lanes(b->width, sizeof(short *));
+  b->scalar = alloc_lanes(b->width, sizeof(short));
+  b->live = alloc_lanes(b->width, sizeof(short));
+  b->state = alloc_lanes(b->width, sizeof(char));
+  b->executed = alloc_lanes(b->width, sizeof(long));
+  if( ! (b->m && b->slab && b->ref && b->ac && b->pc && b->mq && b->sr &&
+         b->time && b->slack && b->mem && b->scalar && b->live &&
+         b->state && b->executed) ){
+    batch_destroy(b);
+    return NULL;
+  }
+
+  for( int i = 0; i < b->width; i++ ){
+    if( i >= lanes ){
+      // Padding up to a full vector never runs.
+      b->state[i] = BATCH_HALTED;
+      b->mem[i] = b->m[0]->mem;
+      continue;
+    }
+    if( ! cpu_setup((pdp8_machine_t *)(b->slab + i * LANE_STRIDE)) ){
+      batch_destroy(b);
+      return NULL;
+    }
+    b->m[i] = (pdp8_machine_t *)(b->slab + i * LANE_STRIDE);
+    clone(b->m[i], m);
+    b->mem[i] = b->m[i]->mem;
+    if( verify ){
+      b->ref[i] = cpu_create();
+      if( b->ref[i] == NULL ){
+        batch_destroy(b);
+        return NULL;
+      }
+    }
+  }
+  b->breakpoints = b->m[0]->breakpoints;
+  b->stop_checks = m->stop_checks;
+  return b;
+}
+
+
+void batch_destroy(batch_t *b)
+{
+  for( int i = 0; i < b->width; i++ ){
+    if( b->m && b->m[i] ){
+      cpu_release(b->m[i]);
+    }
+    if( b->ref && b->ref[i] ){
+      cpu_destroy(b->ref[i]);
+    }
+  }
+  free(b->m);
+  free(b->slab);
+  free(b->ref);
+  free(b->ac);
+  free(b->pc);
+  free(b->mq);
+  free(b->sr);
+  free(b->time);
+  free(b->slack);
+  free(b->mem);
+  free(b->scalar);
+  free(b->live);
+  free(b->state);
+  free(b->executed);
+  free(b);
+}
+
+
+// The machine of one lane, its registers are up to date outside of
+// batch_run().
+pdp8_machine_t *batch_lane(batch_t *b, int lane)
+{
+  return b->m[lane];
+}
+
+
+char batch_state(batch_t *b, int lane)
+{
+  return b->state[lane];
+}
+
+
+long batch_executed(batch_t *b, int lane)
+{
+  return b->executed[lane];
+}
+
+
+// Interrupts, a pending ION or RTF, a pending change of instruction
+// field and user mode are all left to cpu_process().
+static short needs_scalar(pdp8_machine_t *m)
+{
+  if( (m->ion && m->intr) || m->ion_delay || m->rtf_delay ||
+      m->intr_inhibit || m->uf ){
+    return -1;
+  }
+  return 0;
+}
+
+
+static int time_to_event(pdp8_machine_t *m)
+{
+  if( m->deadline <= m->time ){
+    return 0;
+  }
+  return m->deadline - m->time < INT_MAX ? m->deadline - m->time : INT_MAX;
+}
+
+
+// Copy the registers and time of lane i to its machine, and back.
+static void load_lane(batch_t *b, int i)
+{
+  pdp8_machine_t *m = b->m[i];
+
+  m->ac = b->ac[i];
+  m->pc = b->pc[i];
+  m->mq = b->mq[i];
+  m->time = b->time[i];
+}
+
+
+static void save_lane(batch_t *b, int i)
+{
+  pdp8_machine_t *m = b->m[i];
+
+  b->ac[i] = m->ac;
+  b->pc[i] = m->pc;
+  b->mq[i] = m->mq;
+  b->time[i] = m->time;
+  b->slack[i] = time_to_event(m);
+}
+
+
+// The lane state after the lane's instruction number executed. Runs
+// the device events that are due and checks breakpoint conditions and
+// stop_at like machine_run().
+static char lane_check(pdp8_machine_t *m, short pc, long executed,
+                       long limit, char state)
+{
+  event_run(m);
+  if( state == BATCH_RUNNING ){
+    if( (m->breakpoints[pc] & STOP_AT) ||
+        ((m->breakpoints[pc] & BREAKPOINT) && machine_bp_cond_stop(m)) ){
+      return BATCH_STOPPED;
+    }
+    if( limit && executed >= limit ){
+      return BATCH_LIMIT;
+    }
+  }
+  return state;
+}
+
+
+// Step one lane through cpu_process().
+static char step_lane(batch_t *b, int i)
+{
+  pdp8_machine_t *m = b->m[i];
+  char state = BATCH_RUNNING;
+
+  load_lane(b, i);
+  if( cpu_process(m) == -1 ){
+    state = BATCH_HALTED;
+  }
+  save_lane(b, i);
+  return state;
+}
+
+
+// Run a lane that has split off from its vector on its own with
+// cpu_run(), one event deadline at a time, until it halts, stops or
+// reaches the limit.
+static char run_lane(batch_t *b, int i, long limit)
+{
+  pdp8_machine_t *m = b->m[i];
+  char state = BATCH_RUNNING;
+
+  load_lane(b, i);
+  while( state == BATCH_RUNNING ){
+    long budget = limit ? limit - b->executed[i] : LONG_MAX;
+    b->executed[i] += cpu_run(m, budget);
+    if( m->attention & ATTN_HALT ){
+      m->attention &= ~ATTN_HALT;
+      state = BATCH_HALTED;
+    }
+    state = lane_check(m, m->pc, b->executed[i], limit, state);
+  }
+  save_lane(b, i);
+  return state;
+}
+
+
+// Run the reference machine of a lane one cpu_process() at a time.
+static char run_reference(pdp8_machine_t *r, long *executed, long limit)
+{
+  char state = BATCH_RUNNING;
+
+  while( state == BATCH_RUNNING ){
+    if( cpu_process(r) == -1 ){
+      state = BATCH_HALTED;
+    }
+    (*executed)++;
+    state = lane_check(r, r->pc, *executed, limit, state);
+  }
+  return state;
+}
+
+
+#ifdef __GNUC__
+// Instructions that step_vector() can run.
+static int vectorizable(short mb)
+{
+  if( (mb & IF_MASK) == IOT ){
+    return 1;
+  }
+  if( (mb & IF_MASK) != OPR || ! (mb & OPR_G2) ){
+    return 1;
+  }
+  if( ! (mb & OPR_G3) ){
+    return ! (mb & HLT);
+  }
+  // Group three, only CLA, MQA and MQL
+  return ! (mb & ~(IF_MASK|OPR_G2|OPR_G3|CLA|MQA|MQL));
+}
+
+
+#define INC_VPC(pc) (((pc) & FIELD_MASK) | (((pc) + 1) & B12_MASK))
+
+
+// Execute OPR mb in the lanes set in mask, as vector operations.
+static void step_opr(batch_t *b, int base, short mb, short next,
+                     const vec_t *mask)
+{
+  vec_t *vac = (vec_t *)(b->ac + base);
+  vec_t *vpc = (vec_t *)(b->pc + base);
+  vec_t *vmq = (vec_t *)(b->mq + base);
+  vec_t ac = *vac;
+  vec_t mq = *vmq;
+  vec_t pc = { 0 };
+
+  pc += next;
+  if( ! (mb & OPR_G2) ){
+    // Group one, in the order of cpu_process()
+    if( mb & CLA ) ac &= LINK_MASK;
+    if( mb & CLL ) ac &= AC_MASK;
+    if( mb & CMA ) ac ^= AC_MASK;
+    if( mb & CML ) ac ^= LINK_MASK;
+    if( mb & IAC ) ac = (ac + 1) & LINK_AC_MASK;
+    for( int i = (mb & RAR) ? ((mb & BSW) ? 2 : 1) : 0; i > 0; i-- ){
+      ac = (ac >> 1) | ((ac & 1) << 12);
+    }
+    for( int i = (mb & RAL) ? ((mb & BSW) ? 2 : 1) : 0; i > 0; i-- ){
+      ac = ((ac << 1) & LINK_AC_MASK) | ((ac >> 12) & 1);
+    }
+    if( (mb & (RAR|RAL|BSW)) == BSW ){
+      ac = (ac & LINK_MASK) | ((ac & 07700) >> 6) | ((ac & 00077) << 6);
+    }
+  } else if( ! (mb & OPR_G3) ){
+    // Group two, the skip conditions are lane masks
+    vec_t cond = { 0 };
+    if( mb & SMA ) cond |= (ac & SIGN_BIT_MASK) != 0;
+    if( mb & SZA ) cond |= (ac & AC_MASK) == 0;
+    if( mb & SNL ) cond |= (ac & LINK_MASK) != 0;
+    if( mb & OPR_AND ){
+      cond = ~cond;
+    }
+    if( mb & CLA ) ac &= LINK_MASK;
+    pc = (cond & INC_VPC(pc)) | (~cond & pc);
+    if( mb & OSR ) ac |= *(vec_t *)(b->sr + base);
+  } else {
+    // Group three
+    if( mb & CLA ) ac &= LINK_MASK;
+    if( (mb & MQA) && (mb & MQL) ){
+      vec_t tmp = mq & B12_MASK;
+      mq = ac & AC_MASK;
+      ac = (ac & LINK_MASK) | tmp;
+    } else {
+      if( mb & MQA ) ac |= mq & B12_MASK;
+      if( mb & MQL ){
+        mq = ac & AC_MASK;
+        ac &= LINK_MASK;
+      }
+    }
+  }
+
+  *vac = (ac & *mask) | (*vac & ~*mask);
+  *vpc = (pc & *mask) | (*vpc & ~*mask);
+  *vmq = (mq & *mask) | (*vmq & ~*mask);
+}
+
+
+// Execute the instruction of the first lane that is free to take the
+// vector path, in every lane at the same address with the same
+// instruction word. Sets the lanes it stepped in stepped and returns
+// how many, 0 if the instruction is left to cpu_process(). Padding
+// lanes read the memory of lane 0 and are never selected.
+static int step_vector(batch_t *b, int base, short *stepped)
+{
+  pdp8_machine_t **m = b->m + base;
+  short **mem = b->mem + base;
+  short *ac = b->ac + base;
+  short *pc = b->pc + base;
+  unsigned long long *time = b->time + base;
+  int *slack = b->slack + base;
+  vec_t mask;
+  // Per lane work goes through arrays, element access of vector
+  // variables is slow.
+  short sel[BATCH_WIDTH];
+  short pc0, mb, next, addr, t;
+  int lead, n = 0;
+
+  for( lead = 0; lead < BATCH_WIDTH; lead++ ){
+    if( ! b->scalar[base + lead] ){
+      break;
+    }
+  }
+  if( lead == BATCH_WIDTH ){
+    return 0;
+  }
+  pc0 = pc[lead];
+  mb = mem[lead][pc0];
+  if( ! vectorizable(mb) ){
+    return 0;
+  }
+
+  // Lanes at the same address with the same instruction word
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    sel[i] = -((pc[i] == pc0) & (mem[i][pc0] == mb)) & ~b->scalar[base + i];
+  }
+
+  // Statistics, coverage and time of each lane
+  t = cpu_instruction_time(pc0, mb);
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    if( sel[i] ){
+      CPU_COUNT(m[i], pc0, mb);
+      COVERAGE_SET(m[i], pc0);
+      n++;
+    }
+  }
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    time[i] += sel[i] & t;
+  }
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    slack[i] -= sel[i] & t;
+  }
+  memcpy(stepped, sel, sizeof(sel));
+
+  next = INC_VPC(pc0);
+  if( (mb & IF_MASK) == OPR ){
+    memcpy(&mask, sel, sizeof(sel));
+    step_opr(b, base, mb, next, &mask);
+    return n;
+  }
+  if( (mb & IF_MASK) == IOT ){
+    // Devices are private to each lane. Afterwards the lane may have
+    // an interrupt or a delayed ION pending.
+    for( int i = 0; i < BATCH_WIDTH; i++ ){
+      if( sel[i] ){
+        pc[i] = next;
+        load_lane(b, base + i);
+        m[i]->mb = mb;
+        cpu_iot(m[i]);
+        save_lane(b, base + i);
+        b->scalar[base + i] = needs_scalar(m[i]);
+      }
+    }
+    return n;
+  }
+
+  addr = direct_addr(pc0, mb);
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    short ea = addr;
+    short word;
+
+    if( ! sel[i] ){
+      continue;
+    }
+    if( mb & I_MASK ){
+      if( (addr & (PAGE_MASK|WORD_MASK)) >= 010 &&
+          (addr & (PAGE_MASK|WORD_MASK)) <= 017 ){
+        cpu_store_mem(m[i], addr, INC_12BIT(mem[i][addr]));
+      }
+      // For AND, TAD, ISZ and DCA the field is set by DF
+      ea = ((mb & IF_MASK) < JMS ? m[i]->df_base : (addr & FIELD_MASK)) |
+        (mem[i][addr] & B12_MASK);
+    }
+    pc[i] = next;
+    switch( mb & IF_MASK ){
+    case AND:
+      ac[i] &= mem[i][ea] | LINK_MASK;
+      break;
+    case TAD:
+      ac[i] = (ac[i] + mem[i][ea]) & LINK_AC_MASK;
+      break;
+    case ISZ:
+      word = INC_12BIT(mem[i][ea]);
+      cpu_store_mem(m[i], ea, word);
+      if( word == 0 ){
+        pc[i] = INC_VPC(next);
+      }
+      break;
+    case DCA:
+      cpu_store_mem(m[i], ea, ac[i] & AC_MASK);
+      ac[i] &= LINK_MASK;
+      break;
+    case JMS:
+      cpu_store_mem(m[i], ea, INC_12BIT(pc0));
+      pc[i] = (next & FIELD_MASK) | ((ea + 1) & B12_MASK);
+      break;
+    case JMP:
+      pc[i] = ea;
+      break;
+    }
+  }
+  return n;
+}
+#endif
+
+
+// Step every running lane of one vector by one instruction. Lanes
+// that leave the vector are run to completion on their own. Returns
+// the number of lanes still running.
+static int step_chunk(batch_t *b, int base, long limit)
+{
+  short mask[BATCH_WIDTH] = { 0 };
+  short *live = b->live + base;
+  int *slack = b->slack + base;
+  long *executed = b->executed + base;
+  short slow = 0;
+  short check = 0;
+  int vector = 0;
+  int running = 0;
+
+#ifdef __GNUC__
+  vector = step_vector(b, base, mask);
+#endif
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    slow |= live[i] & ~mask[i];
+  }
+  if( slow ){
+    for( int i = base; i < base + BATCH_WIDTH; i++ ){
+      if( ! live[i - base] || mask[i - base] ){
+        continue;
+      }
+      if( vector && ! b->scalar[i] ){
+        // Diverged from the lanes that took the vector path
+        b->state[i] = run_lane(b, i, limit);
+        b->scalar[i] = -1;
+        live[i - base] = 0;
+        continue;
+      }
+      b->state[i] = step_lane(b, i);
+      b->scalar[i] = needs_scalar(b->m[i]);
+      check |= b->state[i] != BATCH_RUNNING;
+    }
+  }
+
+  // Without branches, so that they vectorize. Device events are due
+  // when a lane reaches its deadline.
+  for( int i = 0; i < BATCH_WIDTH; i++ ){
+    short one = live[i] & 1;
+    executed[i] += one;
+    check |= live[i] & -(slack[i] <= 0);
+    running += one;
+  }
+  if( limit ){
+    for( int i = 0; i < BATCH_WIDTH; i++ ){
+      check |= live[i] & -(executed[i] >= limit);
+    }
+  }
+  if( b->stop_checks && running ){
+    // Usually every lane is at the same address
+    int lead = 0;
+    short pc0, same = -1;
+
+    while( ! live[lead] ){
+      lead++;
+    }
+    pc0 = b->pc[base + lead];
+    for( int i = 0; i < BATCH_WIDTH; i++ ){
+      same &= ~live[i] | -(b->pc[base + i] == pc0);
+    }
+    if( same ){
+      check |= b->breakpoints[pc0];
+    } else {
+      for( int i = 0; i < BATCH_WIDTH; i++ ){
+        check |= live[i] & b->breakpoints[b->pc[base + i]];
+      }
+    }
+  }
+  if( ! check ){
+    return running;
+  }
+
+  for( int i = base; i < base + BATCH_WIDTH; i++ ){
+    if( ! live[i - base] ){
+      continue;
+    }
+    load_lane(b, i);
+    b->state[i] = lane_check(b->m[i], b->pc[i], b->executed[i], limit,
+                             b->state[i]);
+    save_lane(b, i);
+    b->scalar[i] = needs_scalar(b->m[i]);
+    if( b->state[i] != BATCH_RUNNING ){
+      b->scalar[i] = -1;
+      live[i - base] = 0;
+      running--;
+    }
+  }
+  return running;
+}
+
+
+// Run all lanes until they halt, stop or have executed limit
+// instructions in total (0 for no limit). Returns the number of
+// instructions executed by all lanes together.
+long batch_run(batch_t *b, long limit)
+{
+  long *start = calloc(b->lanes, sizeof(long));
+  long total = 0;
+
+  if( start == NULL ){
+    return 0;
+  }
+  for( int i = 0; i < b->width; i++ ){
+    pdp8_machine_t *m = b->m[i];
+
+    b->scalar[i] = -1;
+    b->live[i] = 0;
+    if( b->state[i] != BATCH_RUNNING ){
+      continue;
+    }
+    b->live[i] = -1;
+    start[i] = b->executed[i];
+    b->ac[i] = m->ac;
+    b->pc[i] = m->pc;
+    b->mq[i] = m->mq;
+    b->sr[i] = m->sr;
+    b->time[i] = m->time;
+    b->slack[i] = time_to_event(m);
+    b->scalar[i] = needs_scalar(m);
+    if( b->verify ){
+      clone(b->ref[i], m);
+    }
+  }
+
+  // Lanes in different vectors never interact, so each vector is run
+  // to completion while its lanes' memory is in the cache.
+  for( int base = 0; base < b->width; base += BATCH_WIDTH ){
+    while( step_chunk(b, base, limit) >= BATCH_MIN_LOCKSTEP )
+      ;
+    for( int i = base; i < base + BATCH_WIDTH; i++ ){
+      if( b->live[i] ){
+        b->state[i] = run_lane(b, i, limit);
+        b->live[i] = 0;
+      }
+    }
+  }
+
+  for( int i = 0; i < b->lanes; i++ ){
+    pdp8_machine_t *m = b->m[i];
+
+    total += b->executed[i] - start[i];
+    m->ac = b->ac[i];
+    m->pc = b->pc[i];
+    m->mq = b->mq[i];
+    m->time = b->time[i];
+    if( b->verify && b->executed[i] != start[i] ){
+      pdp8_machine_t *r = b->ref[i];
+      long executed = start[i];
+      char state = run_reference(r, &executed, limit);
+      if( state != b->state[i] || executed != b->executed[i] ||
+          r->ac != m->ac || r->pc != m->pc || r->mq != m->mq ||
+          r->time != m->time || memcmp(r->mem, m->mem, sizeof(m->mem)) ){
+        b->state[i] = BATCH_MISMATCH;
+      }
+    }
+  }
+  free(start);
+  return total;
+}
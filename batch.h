@@ -0,0 +1,31 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+#include "cpu.h"
+
+// A batch of copies of one machine, stepped in lockstep. See batch.c.
+typedef struct batch batch_t;
+
+// Lane states
+#define BATCH_RUNNING 0
+#define BATCH_HALTED 1   // HLT executed
+#define BATCH_STOPPED 2  // Reached a breakpoint or stop_at
+#define BATCH_LIMIT 3    // Executed the instruction limit
+#define BATCH_MISMATCH 4 // Differs from the cpu_process() reference
+
+batch_t *batch_create(pdp8_machine_t *m, int lanes, char verify);
+void batch_destroy(batch_t *b);
+pdp8_machine_t *batch_lane(batch_t *b, int lane);
+long batch_run(batch_t *b, long limit);
+char batch_state(batch_t *b, int lane);
+long batch_executed(batch_t *b, int lane);
+
+#endif // _BATCH_H_
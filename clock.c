@@ -0,0 +1,70 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#include "clock.h"
+#include "cpu.h"
+#include "pdp8.h"
+
+// Raise the flag if the emulated time has passed a tick. Ticks that
+// nobody saw are lost, like on the real line clock.
+void clk_update(pdp8_machine_t *m)
+{
+  if( m->time >= m->clk.next_tick ){
+    m->clk.next_tick +=
+      ((m->time - m->clk.next_tick) / m->clk.period + 1) * m->clk.period;
+    m->clk.flag = 1;
+  }
+  if( m->clk.flag && m->clk.ie ){
+    cpu_raise_interrupt(m, CLK_INTR_FLAG);
+  }
+}
+
+static char clk_tick(pdp8_machine_t *m)
+{
+  clk_update(m);
+  event_post(m, m->clk.next_tick - m->time, clk_tick);
+  return 0;
+}
+
+// CAF and power on, the line keeps ticking.
+void clk_reset(pdp8_machine_t *m)
+{
+  clk_update(m);
+  clk_enable_interrupt(m, 0);
+  m->clk.flag = 0;
+}
+
+void clk_set_frequency(pdp8_machine_t *m, short hz)
+{
+  m->clk.period = CLK_PERIOD(hz);
+  m->clk.next_tick = m->time + m->clk.period;
+}
+
+// CLEI and CLDI
+void clk_enable_interrupt(pdp8_machine_t *m, short enable)
+{
+  m->clk.ie = enable;
+  m->intr &= ~CLK_INTR_FLAG;
+  if( enable ){
+    clk_tick(m);
+  } else {
+    event_cancel(m, clk_tick);
+  }
+}
+
+// CLSC, returns 1 if the flag was set and clears it.
+char clk_skip_flag(pdp8_machine_t *m)
+{
+  clk_update(m);
+  if( ! m->clk.flag ){
+    return 0;
+  }
+  m->clk.flag = 0;
+  m->intr &= ~CLK_INTR_FLAG;
+  return 1;
+}
@@ -0,0 +1,32 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+#include "cpu.h"
+
+// DK8-EA line frequency clock registers, part of pdp8_machine_t. The
+// flag is brought up to date from the emulated time by clk_update(),
+// the tick event is only scheduled while the interrupt is enabled.
+typedef struct clk {
+  unsigned long long next_tick; // Emulated time of the next tick
+  unsigned long long period; // Nanoseconds per tick
+  short flag;
+  short ie; // Interrupt enable
+} clk_t;
+
+#define CLK_PERIOD(hz) (1000000000ULL / (hz))
+
+void clk_reset(pdp8_machine_t *m);
+void clk_set_frequency(pdp8_machine_t *m, short hz);
+void clk_update(pdp8_machine_t *m);
+void clk_enable_interrupt(pdp8_machine_t *m, short enable);
+char clk_skip_flag(pdp8_machine_t *m);
+
+#endif // _CLOCK_H_
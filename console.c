@@ -11,14 +11,22 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <ctype.h>
 #include <signal.h>
 #include <getopt.h>
 #include <errno.h>
+#include <poll.h>
+#include <time.h>
 #include "linenoise.h"
 #include "console.h"
 #include "cpu.h"
 #include "tty.h"
 #include "machine.h"
+#include "prof.h"
+#include "trace.h"
+#ifdef SERVER_BUILD
+#include "batch.h"
+#endif
 
 char in_console = 1;
 // flags set by options:
@@ -27,6 +35,20 @@ short stop_at = -1;
 char *pty_name = NULL;
 char *restore_file = NULL;
 char start_running = 0;
+char engine = -1;
+short speed = -1; // Percent of PDP-8/E speed, 0 for max
+short clock_hz = 60; // DK8-EA line frequency
+char warp = 0;
+long profile = 0; // Sample period of --profile
+char profile_flags = 0; // PROF_PER_TIME and PROF_CALLS
+short sweep_first = -1; // Switch register range of --sweep_sr
+short sweep_last = -1;
+long sweep_limit = 0;
+char sweep_verify = 0;
+char *coverage_file = NULL; // --coverage, merged into on exit
+int history_on_stop = 0; // --history, entries printed on HLT and breakpoints
+char *trace_file = NULL; // --trace_file
+pdp8_machine_t *machine = NULL; // NULL in the PTY client
 
 void signal_handler(int signo)
 {
@@ -36,7 +58,7 @@ void signal_handler(int signo)
     if( ! in_console ) {
       printf("CPU running, attempting to interrupt\n");
       //      in_console = 0; TODO probably not needed
-      machine_interrupt();
+      machine_interrupt(machine);
     }
   }
 }
@@ -46,22 +68,55 @@ struct termios told, tnew;
 
 void completion_cb(const char *buf, linenoiseCompletions *lc);
 void print_regs();
+unsigned long long examine_time();
+void print_stats();
+void print_heatmap();
+void print_history(int n);
+const char *watch_kinds(char kinds);
+int parse_watch_kinds(const char *str);
+int save_heatmap(char *filename);
+void print_eae(FILE *out, short pc, short cur);
+void fprint_instruction(FILE *out, short pc);
 void print_instruction(short pc);
 int save_state(char *filename);
 int restore_state(char *filename);
+int save_coverage(char *filename, char merge);
+int list_coverage(char *filename);
+int sweep(void);
+int parse_trace_filter(char *expr, trace_filter_t *filter);
+int parse_bp_cond(char *expr, bp_cond_t *cond);
+void print_bp_cond(const bp_cond_t *cond);
 void parse_options(int argc, char **argv);
 void exit_cleanup(void);
 
 void console_setup(int argc, char **argv)
 {
   parse_options(argc, argv);
-  machine_setup(pty_name);
+  machine = machine_setup(pty_name);
   if( stop_at > 0 ){
-    machine_set_stop_at(stop_at);
+    machine_set_stop_at(machine, stop_at);
+  }
+  if( engine >= 0 ){
+    machine_set_engine(machine, engine);
+  }
+  if( speed >= 0 ){
+    machine_set_speed(machine, speed);
+  }
+  if( clock_hz != 60 || warp ){
+    machine_set_clock(machine, clock_hz, warp);
+  }
+  if( profile > 0 || profile_flags ){
+    machine_set_profile(machine, profile, profile_flags);
   }
   if( restore_file != NULL && ! restore_state(restore_file) ){
     exit(EXIT_FAILURE);
   }
+  if( trace_file != NULL && ! machine_set_trace_file(machine, trace_file) ){
+    exit(EXIT_FAILURE);
+  }
+  if( sweep_first >= 0 ){
+    exit(sweep() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
 
   // TODO use on_exit to avoid save_state() on EXIT_FAILURE
   atexit(exit_cleanup); // register after parse_option so prev.core
@@ -101,14 +156,14 @@ void console_setup(int argc, char **argv)
 
 void console_trace_instruction()
 {
-  short ion = machine_examine_reg(ION_FLAG);
-  short intr = machine_examine_reg(INTR);
-  short intr_inhibit = machine_examine_reg(INTR_INHIBIT);
-  short pc = machine_examine_reg(PC);
+  short ion = machine_examine_reg(machine, ION_FLAG);
+  short intr = machine_examine_reg(machine, INTR);
+  short intr_inhibit = machine_examine_reg(machine, INTR_INHIBIT);
+  short pc = machine_examine_reg(machine, PC);
 
   if( ion && intr && (! intr_inhibit) ){
     // An interrupt occured, disable interrupts, force JMS to 0000
-    short mem = machine_examine_mem(pc);
+    short mem = machine_examine_mem(machine, pc);
     printf("%.6o  %.6o INTERRUPT ==> JMS to 0", pc, mem);
   } else {
     print_instruction(pc);
@@ -116,49 +171,91 @@ void console_trace_instruction()
 }
 
 
-void print_instruction(short pc)
-{ 
-  short cur = machine_examine_mem(pc);
-  short addr = machine_operand_addr(pc, 1);
+// The EAE part of a group three OPR. Its meaning depends on the
+// current EAE mode. Operations with an operand show the next word, in
+// mode B as the operand address.
+void print_eae(FILE *out, short pc, short cur)
+{
+  static const char *mode_a[] = { "", " SCL", " MUY", " DVI", " NMI", " SHL", " ASR", " LSR" };
+  static const char *mode_b[] = { "", " ACS", " MUY", " DVI", " NMI", " SHL", " ASR", " LSR",
+                                  " SCA", " DAD", " DST", " SWBA", " DPSZ", " DPIC", " DCM", " SAM" };
+  short mode_b_active = machine_examine_reg(machine, EAE_MODE);
+  short code = (cur & (SCA|EAE_OP_MASK)) >> 1;
+  short next = (pc & FIELD_MASK) | INC_12BIT(pc);
+  short operand = machine_examine_mem(machine, next);
+
+  if( cur == SWAB ){
+    fprintf(out, " SWAB");
+    return;
+  }
+
+  if( mode_b_active ){
+    fprintf(out, "%s", mode_b[(code & 07) | ((code & 020) >> 1)]);
+    switch( code ){
+    case 02: case 03: case 021: case 022: // MUY, DVI, DAD, DST
+      fprintf(out, " %.5o", (machine_examine_reg(machine, DF) << 12) | operand);
+      break;
+    case 05: case 06: case 07: // SHL, ASR, LSR
+      fprintf(out, " [%.4o]", operand);
+      break;
+    }
+  } else {
+    if( code & 020 ){
+      fprintf(out, " SCA");
+    }
+    fprintf(out, "%s", mode_a[code & 07]);
+    if( (code & 07) != 00 && (code & 07) != 04 ){ // All but NMI have an operand
+      fprintf(out, " [%.4o]", operand);
+    }
+  }
+}
 
-  printf("%.5o  %.4o", pc, cur);
+
+// Disassemble the word at pc, with the operand address and value of
+// MRIs, on one line of out.
+void fprint_instruction(FILE *out, short pc)
+{
+  short cur = machine_examine_mem(machine, pc);
+  short addr = machine_operand_addr(machine, pc, 1);
+
+  fprintf(out, "%.5o  %.4o", pc, cur);
 
   if( (cur & IF_MASK) <= JMP ){
     switch( cur & IF_MASK ){
     case AND:
-      printf(" AND");
+      fprintf(out, " AND");
       break;
     case TAD:
-      printf(" TAD");
+      fprintf(out, " TAD");
       break;
     case ISZ:
-      printf(" ISZ");
+      fprintf(out, " ISZ");
       break;
     case DCA:
-      printf(" DCA");
+      fprintf(out, " DCA");
       break;
     case JMS:
-      printf(" JMS");
+      fprintf(out, " JMS");
       break;
     case JMP:
-      printf(" JMP");
+      fprintf(out, " JMP");
       break;
     }
 
     if( ! (cur & Z_MASK) ) {
-      printf(" Z");
+      fprintf(out, " Z");
     } else {
-      printf("  ");
+      fprintf(out, "  ");
     }
 
     if( cur & I_MASK ){
-      printf(" I %.5o (%.5o)", machine_direct_addr(pc), addr);
+      fprintf(out, " I %.5o (%.5o)", machine_direct_addr(machine, pc), addr);
     } else {
-      printf("   %.5o", addr);
+      fprintf(out, "   %.5o", addr);
     }
 
     if( (cur & IF_MASK) < JMS ){
-      printf(" [%.4o]", machine_examine_mem(addr));
+      fprintf(out, " [%.4o]", machine_examine_mem(machine, addr));
     }
 
   } else {
@@ -168,42 +265,40 @@ void print_instruction(short pc)
       case 00: // Interrupt control
         switch( cur & IOT_OP_MASK ){
         case SKON:
-          printf(" SKON");
+          fprintf(out, " SKON");
           break;
         case ION:
-          printf(" ION");
+          fprintf(out, " ION");
           break;
         case IOF:
-          printf(" IOF");
+          fprintf(out, " IOF");
           break;
         case SRQ:
-          printf(" SRQ");
+          fprintf(out, " SRQ");
           break;
         case GTF:
-          // TODO add more fields as support is added. (GT)
           {
-            short ac = machine_examine_reg(AC);
-            short intr = machine_examine_reg(INTR);
-            short ion = machine_examine_reg(ION_FLAG);
-            short sf = machine_examine_reg(SF);
-            printf(" GTF (LINK = %o INTR = %o ION = %o U = %o IF = %o DF = %o)",
-                   LINK, intr, ion, ((sf & 0100) >> 6), ((sf & 070) >> 3), sf & 07);
+            short ac = machine_examine_reg(machine, AC);
+            short gt = machine_examine_reg(machine, GT);
+            short intr = machine_examine_reg(machine, INTR);
+            short ion = machine_examine_reg(machine, ION_FLAG);
+            short sf = machine_examine_reg(machine, SF);
+            fprintf(out, " GTF (LINK = %o GT = %o INTR = %o ION = %o U = %o IF = %o DF = %o)",
+                   LINK, gt, intr, ion, ((sf & 0100) >> 6), ((sf & 070) >> 3), sf & 07);
           }
           break;
         case RTF:
-          // TODO restore more fields. (GT);
           {
-            short ac = machine_examine_reg(AC);
-            printf(" RTF (LINK = %o INHIB = %o ION = %o U = %o IF = %o DF = %o)",
-                   (ac >> 11) & 1, (ac >> 8) & 1, (ac >> 7) & 1, (ac >> 6) & 1, (ac >> 3) & 07, ac & 07);
+            short ac = machine_examine_reg(machine, AC);
+            fprintf(out, " RTF (LINK = %o GT = %o INHIB = %o ION = %o U = %o IF = %o DF = %o)",
+                   (ac >> 11) & 1, (ac >> 10) & 1, (ac >> 8) & 1, (ac >> 7) & 1, (ac >> 6) & 1, (ac >> 3) & 07, ac & 07);
           }
           break;
         case SGT:
-          // TODO add with EAE support
-          printf(" SGT");
+          fprintf(out, " SGT (GT = %o)", machine_examine_reg(machine, GT));
           break;
         case CAF:
-          printf(" CAF");
+          fprintf(out, " CAF");
           break;
         }
         break;
@@ -211,50 +306,66 @@ void print_instruction(short pc)
       case 03: // Console tty input
         switch( cur & IOT_OP_MASK ){
         case KCF:
-          printf(" KCF");
+          fprintf(out, " KCF");
           break;
         case KSF:
-          printf(" KSF");
+          fprintf(out, " KSF");
           break;
         case KCC:
-          printf(" KCC");
+          fprintf(out, " KCC");
           break;
         case KRS:
-          printf(" KRS");
+          fprintf(out, " KRS");
           break;
         case KIE:
-          printf(" KIE");
+          fprintf(out, " KIE");
           break;
         case KRB:
-          printf(" KRB");
+          fprintf(out, " KRB");
           break;
         default:
-          printf(" illegal IOT instruction. device 03 - keyboard");
+          fprintf(out, " illegal IOT instruction. device 03 - keyboard");
           break;
         }
         break;
       case 04: // Console tty output
         switch( cur & IOT_OP_MASK ){
         case TFL:
-          printf(" TFL"); // TODO called SPF in some assemblers?
+          fprintf(out, " TFL"); // TODO called SPF in some assemblers?
           break;
         case TSF:
-          printf(" TSF");
+          fprintf(out, " TSF");
           break;
         case TCF:
-          printf(" TCF");
+          fprintf(out, " TCF");
           break;
         case TPC:
-          printf(" TPC");
+          fprintf(out, " TPC");
           break;
         case TSK:
-          printf(" TSK"); // TODO called SPI in some assemblers?
+          fprintf(out, " TSK"); // TODO called SPI in some assemblers?
           break;
         case TLS:
-          printf(" TLS");
+          fprintf(out, " TLS");
           break;
         default:
-          printf(" illegal IOT instruction. device 04 - TTY output");
+          fprintf(out, " illegal IOT instruction. device 04 - TTY output");
+          break;
+        }
+        break;
+      case 013: // DK8-EA line clock
+        switch( cur & IOT_OP_MASK ){
+        case CLEI:
+          fprintf(out, " CLEI");
+          break;
+        case CLDI:
+          fprintf(out, " CLDI");
+          break;
+        case CLSC:
+          fprintf(out, " CLSC");
+          break;
+        default:
+          fprintf(out, " illegal IOT instruction. device 13 - clock");
           break;
         }
         break;
@@ -268,163 +379,165 @@ void print_instruction(short pc)
       case 027: // Memory management
         switch( cur & IOT_OP_MASK ){
         case 01:
-          printf(" CDF");
+          fprintf(out, " CDF");
           break;
         case 02:
-          printf(" CIF");
+          fprintf(out, " CIF");
           break;
         case 03:
-          printf(" CDI");
+          fprintf(out, " CDI");
           break;
         case 04:
           // Mask out the "FIELD" bits which are OPCODES here.
           switch( (cur & MMU_DI_MASK) >> 3 ){
           case 00:
-            printf(" CINT");
+            fprintf(out, " CINT");
             break;
           case 01:
-            printf(" RDF");
+            fprintf(out, " RDF");
             break;
           case 02:
-            printf(" RIF");
+            fprintf(out, " RIF");
             break;
           case 03:
-            printf(" RIB");
+            fprintf(out, " RIB");
             break;
           case 04:
-            printf(" RMF");
+            fprintf(out, " RMF");
             break;
           case 05:
-            printf(" SINT");
+            fprintf(out, " SINT");
             break;
           case 06:
-            printf(" CUF");
+            fprintf(out, " CUF");
             break;
           case 07:
-            printf(" SUF");
+            fprintf(out, " SUF");
             break;
           default:
-            printf(" illegal IOT instruction. MMU(1) device");
+            fprintf(out, " illegal IOT instruction. MMU(1) device");
             break;
           }
           break;
         default:
-          printf(" illegal IOT instruction. MMU(2) device");
+          fprintf(out, " illegal IOT instruction. MMU(2) device");
           break;
         }
         break;
       default:
-        printf(" IOT Device: %.3o", (cur & DEV_MASK) >> 3);
+        fprintf(out, " IOT Device: %.3o", (cur & DEV_MASK) >> 3);
         break;
       }
       break;
     case OPR:
       if( ! (cur & OPR_G2) ){
         if( cur & CLA ){
-          printf(" CLA");
+          fprintf(out, " CLA");
         }
 
         if( cur & CLL ){
-          printf(" CLL");
+          fprintf(out, " CLL");
         }
 
         if( cur & CMA ){
-          printf(" CMA");
+          fprintf(out, " CMA");
         }
 
         if( cur & CML ){
-          printf(" CML");
+          fprintf(out, " CML");
         }
 
         if( cur & IAC ){
-          printf(" IAC");
+          fprintf(out, " IAC");
         }
 
         // TODO CMA & IAC is called CIA in some assemblers, support?
 
         if( cur & RAR ){
           if( cur & BSW ){
-            printf(" RTR");
+            fprintf(out, " RTR");
           } else {
-            printf(" RAR");
+            fprintf(out, " RAR");
           }
         }
 
         if( cur & RAL ){
           if( cur & BSW ){
-            printf(" RTL");
+            fprintf(out, " RTL");
           } else {
-            printf(" RAL");
+            fprintf(out, " RAL");
           }
         }
 
         if( ( cur & (RAR|RAL|BSW) ) == BSW ){
-          printf(" BSW");
+          fprintf(out, " BSW");
         }
 
         if( cur == OPR ){
-          printf(" NOP");
+          fprintf(out, " NOP");
         }
 
       } else {
         if( ! (cur & OPR_G3 ) ){
           if( ! (cur & OPR_AND) ) {
             if( cur & SMA ){
-              printf(" SMA");
+              fprintf(out, " SMA");
             }
 
             if( cur & SZA ){
-              printf(" SZA");
+              fprintf(out, " SZA");
             }
 
             if( cur & SNL ){
-              printf(" SNL");
+              fprintf(out, " SNL");
             }
 
             if( cur & CLA ){
-              printf(" CLA");
+              fprintf(out, " CLA");
             }
           } else {
             if( cur & SPA ){
-              printf(" SPA");
+              fprintf(out, " SPA");
             }
 
             if( cur & SNA ){
-              printf(" SNA");
+              fprintf(out, " SNA");
             }
 
             if( cur & SZL ){
-              printf(" SZL");
+              fprintf(out, " SZL");
             }
 
             if( cur & CLA ){
-              printf(" CLA");
+              fprintf(out, " CLA");
             }
 
             if( ! (cur & (SPA|SNA|SZL)) ){
-              printf(" SKP");
+              fprintf(out, " SKP");
             }
           }
 
           if( cur & OSR ){
-            printf(" OSR");
+            fprintf(out, " OSR");
           }
           if( cur & HLT ){
-            printf(" HLT");
+            fprintf(out, " HLT");
           }
         } else {
           if( cur & CLA ){
-            printf(" CLA");
+            fprintf(out, " CLA");
           }
 
           if( cur & MQA ){
-            printf(" MQA");
+            fprintf(out, " MQA");
           }
 
           if( cur & MQL ){
-            printf(" MQL");
+            fprintf(out, " MQL");
           }
 
+          print_eae(out, pc, cur);
+
           // TODO CLA & MQL is called CAM in some assemblers, support?
           //      MQA & MQL is called SWP in some assemblers.
           //      CLA & OSR is called LAS (Load AC from Switches)
@@ -435,7 +548,13 @@ void print_instruction(short pc)
       break;
     }
   }
-  printf("\n");
+  fprintf(out, "\n");
+}
+
+
+void print_instruction(short pc)
+{
+  fprint_instruction(stdout, pc);
 }
 
 char tty_file[100] = "binloader.rim";
@@ -468,6 +587,17 @@ char console_read_tty_byte(char *output)
   }
 }
 
+// Wait for keyboard input, see wait_tty_input(). A file attached with
+// tty_attach always has input, and a signal like ^C ends the wait.
+void console_wait_tty_input(int timeout)
+{
+  struct pollfd fds = { 0, POLLIN, 0 };
+
+  if( ! tty_read_from_file ){
+    poll(&fds, 1, timeout);
+  }
+}
+
 void console_write_tty_byte(char output)
 {
   write(1, &output, 1);
@@ -480,20 +610,201 @@ void completion_cb(__attribute__((unused)) const char *buf, __attribute__((unuse
 
 void print_regs()
 {
-  short pc = machine_examine_reg(PC);
-  short ac = machine_examine_reg(AC);
-  short mq = machine_examine_reg(MQ);
-  short df = machine_examine_reg(DF);
-  short ib = machine_examine_reg(IB);
-  short uf = machine_examine_reg(UF);
-  short sf = machine_examine_reg(SF);
-  short sr = machine_examine_reg(SR);
-  short ion = machine_examine_reg(ION_FLAG);
-  short intr_inhibit = machine_examine_reg(INTR_INHIBIT);
+  short pc = machine_examine_reg(machine, PC);
+  short ac = machine_examine_reg(machine, AC);
+  short mq = machine_examine_reg(machine, MQ);
+  short df = machine_examine_reg(machine, DF);
+  short ib = machine_examine_reg(machine, IB);
+  short uf = machine_examine_reg(machine, UF);
+  short sf = machine_examine_reg(machine, SF);
+  short sr = machine_examine_reg(machine, SR);
+  short ion = machine_examine_reg(machine, ION_FLAG);
+  short intr_inhibit = machine_examine_reg(machine, INTR_INHIBIT);
 
   printf("PC = %o AC = %o MQ = %o DF = %o IB = %o U = %o SF = %o SR = %o ION = %o INHIB = %o", pc, ac, mq, df, ib, uf, sf, sr, ion, intr_inhibit);
 }
 
+// Emulated time in nanoseconds, read 16 bits at a time.
+unsigned long long examine_time()
+{
+  unsigned long long time = 0;
+  for( int reg = TIME_3; reg >= TIME_0; reg-- ){
+    time = time << 16 | (unsigned short)machine_examine_reg(machine, reg);
+  }
+  return time;
+}
+
+// Print the non-zero statistics counters, see STAT_COUNT in cpu.h.
+void print_stats()
+{
+  static const char *opcode[8] = {
+    "AND", "TAD", "ISZ", "DCA", "JMS", "JMP", "IOT", "OPR"
+  };
+  static const char *opr[3][8] = {
+    { "IAC", "BSW", "RAL", "RAR", "CML", "CMA", "CLL", "CLA" },
+    { "", "HLT", "OSR", "AND", "SNL", "SZA", "SMA", "CLA" },
+    { "", "CODE0", "CODE1", "CODE2", "MQL", "SCA", "MQA", "CLA" }
+  };
+
+  unsigned long long stats[STAT_COUNT];
+
+  if( ! machine_examine_stats(machine, stats) ){
+    printf("Statistics not available, build with -DCPU_STATS\n");
+    return;
+  }
+  for( int i = 0; i < STAT_HEAT(0, 0); i++ ){
+    unsigned long long val = stats[i];
+    if( ! val ){
+      continue;
+    }
+    if( i < STAT_DIRECT ){
+      printf("%-14s %llu\n", opcode[i], val);
+    } else if( i == STAT_DIRECT ){
+      printf("%-14s %llu\n", "DIRECT", val);
+    } else if( i == STAT_INDIRECT ){
+      printf("%-14s %llu\n", "INDIRECT", val);
+    } else if( i == STAT_AUTOINDEX ){
+      printf("%-14s %llu\n", "AUTOINDEX", val);
+    } else if( i < STAT_IOT(0, 0) ){
+      int group = (i - STAT_OPR(1, 0)) / 8 + 1;
+      int bit = (i - STAT_OPR(1, 0)) % 8;
+      printf("OPR%d %.4o %-4s %llu\n", group, 1 << bit, opr[group - 1][bit], val);
+    } else {
+      printf("IOT %.4o       %llu\n", 06000 | (i - STAT_IOT(0, 0)), val);
+    }
+  }
+}
+
+static int bit_length(unsigned long long val)
+{
+  int len = 0;
+  for( ; val; val >>= 1 ){
+    len++;
+  }
+  return len;
+}
+
+// Print the memory heatmap as a grid per access kind, one row per
+// field and one column per page. Each cell shows the count on a log
+// scale from '.' to '@', relative to the busiest page of that kind.
+void print_heatmap()
+{
+  static const char *kinds[HEAT_KINDS] = {
+    [HEAT_FETCH] = "FETCH", [HEAT_READ] = "READ",
+    [HEAT_WRITE] = "WRITE", [HEAT_AUTOINDEX] = "AUTOINDEX"
+  };
+  static const char scale[] = " .:-=+*#%@";
+  unsigned long long stats[STAT_COUNT];
+
+  if( ! machine_examine_stats(machine, stats) ){
+    printf("Statistics not available, build with -DCPU_STATS\n");
+    return;
+  }
+  for( int kind = 0; kind < HEAT_KINDS; kind++ ){
+    const unsigned long long *heat = &stats[STAT_HEAT(kind, 0)];
+    unsigned long long max = 0;
+    for( int page = 0; page < PAGES; page++ ){
+      if( heat[page] > max ){
+        max = heat[page];
+      }
+    }
+    printf("%-10s 0       1       2       3\n", kinds[kind]);
+    printf("%-10s 01234567012345670123456701234567 max %llu\n", "", max);
+    for( int field = 0; field < PAGES / 32; field++ ){
+      printf("  field %o  ", field);
+      for( int page = field * 32; page < field * 32 + 32; page++ ){
+        putchar(scale[heat[page] ? 1 + (bit_length(heat[page]) - 1) * 9 /
+                      bit_length(max) : 0]);
+      }
+      printf("\n");
+    }
+  }
+}
+
+// Write the memory heatmap as CSV, one line per page. Returns 0 on
+// failure.
+int save_heatmap(char *filename)
+{
+  unsigned long long stats[STAT_COUNT];
+  FILE *fh;
+
+  if( ! machine_examine_stats(machine, stats) ){
+    printf("Statistics not available, build with -DCPU_STATS\n");
+    return 0;
+  }
+  fh = fopen(filename, "w");
+  if( fh == NULL ){
+    perror("Unable to open heatmap file");
+    return 0;
+  }
+  fprintf(fh, "field,page,address,fetch,read,write,autoindex\n");
+  for( int page = 0; page < PAGES; page++ ){
+    fprintf(fh, "%d,%d,%.5o", page / 32, page % 32, page << 7);
+    for( int kind = 0; kind < HEAT_KINDS; kind++ ){
+      fprintf(fh, ",%llu", stats[STAT_HEAT(kind, page)]);
+    }
+    fprintf(fh, "\n");
+  }
+  return fclose(fh) == 0;
+}
+
+// Print the last n executed instructions, oldest first, with the AC,
+// link and MQ they started with.
+void print_history(int n)
+{
+  history_t history[HISTORY_SIZE];
+  int len = machine_examine_history(machine, history);
+
+  for( int i = n < len ? len - n : 0; i < len; i++ ){
+    printf("%.5o  %.4o  AC = %.4o L = %o MQ = %.4o\n", history[i].pc,
+           history[i].word, history[i].ac & AC_MASK,
+           (history[i].ac & LINK_MASK) >> 12, history[i].mq);
+  }
+}
+
+// The WATCH_* bits as the letters the watch command takes.
+const char *watch_kinds(char kinds)
+{
+  static char str[4];
+  char *p = str;
+
+  if( kinds & WATCH_READ ) *p++ = 'r';
+  if( kinds & WATCH_WRITE ) *p++ = 'w';
+  if( kinds & WATCH_CHANGE ) *p++ = 'c';
+  *p = '\0';
+  return str;
+}
+
+// Parse the letters r, w and c of the watch command, or clear. NULL is
+// a read and write watch. Returns -1 for anything else.
+int parse_watch_kinds(const char *str)
+{
+  int kinds = 0;
+
+  if( str == NULL ){
+    return WATCH_READ|WATCH_WRITE;
+  }
+  if( ! strcasecmp(str, "clear") ){
+    return 0;
+  }
+  for( ; *str; str++ ){
+    switch( tolower((unsigned char)*str) ){
+    case 'r':
+      kinds |= WATCH_READ;
+      break;
+    case 'w':
+      kinds |= WATCH_WRITE;
+      break;
+    case 'c':
+      kinds |= WATCH_CHANGE;
+      break;
+    default:
+      return -1;
+    }
+  }
+  return kinds ? kinds : -1;
+}
+
 short read_12bit_octal(const char *buf)
 {
   char *endptr;
@@ -542,6 +853,9 @@ typedef enum {
   TTY_SOURCE,
   E_AC,
   E_MQ,
+  E_SC,
+  E_GT,
+  E_TIME,
   E_SR,
   E_ION,
   E_INTR,
@@ -557,6 +871,13 @@ typedef enum {
   E_TTY_KB_FLAG,
   E_TTY_TP_FLAG,
   E_CPU,
+  STATS,
+  HEATMAP,
+  COVERAGE,
+  HISTORY,
+  CLOSE,
+  FILTER,
+  WATCH,
   OCTAL_LITERAL
 } token;
 
@@ -591,6 +912,20 @@ token map_token(char *token)
     return STEP;
   if( ! strcasecmp(token, "trace") || ! strcasecmp(token, "t") )
     return TRACE;
+  if( ! strcasecmp(token, "stats") )
+    return STATS;
+  if( ! strcasecmp(token, "heatmap") )
+    return HEATMAP;
+  if( ! strcasecmp(token, "coverage") )
+    return COVERAGE;
+  if( ! strcasecmp(token, "history") )
+    return HISTORY;
+  if( ! strcasecmp(token, "close") )
+    return CLOSE;
+  if( ! strcasecmp(token, "filter") )
+    return FILTER;
+  if( ! strcasecmp(token, "watch") )
+    return WATCH;
   if( ! strcasecmp(token, "tty_attach") || ! strcasecmp(token, "tty_a") )
     return TTY_ATTACH;
   if( ! strcasecmp(token, "tty_source") || ! strcasecmp(token, "tty_s") )
@@ -599,6 +934,12 @@ token map_token(char *token)
     return E_AC;
   if( ! strcasecmp(token, "mq") )
     return E_MQ;
+  if( ! strcasecmp(token, "sc") )
+    return E_SC;
+  if( ! strcasecmp(token, "gt") )
+    return E_GT;
+  if( ! strcasecmp(token, "time") )
+    return E_TIME;
   if( ! strcasecmp(token, "sr") )
     return E_SR;
   if( ! strcasecmp(token, "ion") )
@@ -689,7 +1030,7 @@ void console(void)
 
       switch(_1st_tok){
       case BREAK:
-        if( NULL_TOKEN != _3rd_tok ){
+        if( NULL_TOKEN != _3rd_tok && OCTAL_LITERAL != _2nd_tok ){
           to_many_args();
           break;
         }
@@ -699,7 +1040,7 @@ void console(void)
         }
 
         if( CLEAR == _2nd_tok ) {
-          machine_clear_all_bp();
+          machine_clear_all_bp(machine);
           printf("Breakpoints cleared\n");
           break;
         }
@@ -707,8 +1048,13 @@ void console(void)
         if( LIST == _2nd_tok ){
           for(int i = 0; i < MEMSIZE; i++) {
             // TODO add tests
-            if( machine_examine_bp(i) ){
-              printf("Breakpoint set at %o\n", i);
+            if( machine_examine_bp(machine, i) ){
+              bp_cond_t cond;
+              printf("Breakpoint set at %o", i);
+              if( machine_examine_bp_cond(machine, i, &cond) ){
+                print_bp_cond(&cond);
+              }
+              printf("\n");
             }
           }
           break;
@@ -720,9 +1066,21 @@ void console(void)
         }
 
         val = read_15bit_octal(_2nd_str);
-        if( val > 0 && val < MEMSIZE ){
-          machine_toggle_bp(val);
-          if( machine_examine_bp(val) ){
+        if( val > 0 && val < MEMSIZE && NULL_TOKEN != _3rd_tok ){
+          bp_cond_t cond;
+          if( ! parse_bp_cond(_3rd_str, &cond) ){
+            break;
+          }
+          if( machine_set_bp_cond(machine, val, &cond) ){
+            printf("Breakpoint set at %o", val);
+            print_bp_cond(&cond);
+            printf("\n");
+          } else {
+            printf("ERROR, at most %d breakpoints with conditions\n", BP_CONDS);
+          }
+        } else if( val > 0 && val < MEMSIZE ){
+          machine_toggle_bp(machine, val);
+          if( machine_examine_bp(machine, val) ){
             printf("Breakpoint set at %o\n", val);
           } else {
             printf("Breakpoint at %o cleared\n", val);
@@ -731,6 +1089,61 @@ void console(void)
           printf("ERROR, breakpoint outside memory\n");
         }
 
+        break;
+      case WATCH:
+        if( NULL_TOKEN == _2nd_tok ){
+          to_few_args();
+          break;
+        }
+
+        if( CLEAR == _2nd_tok ){
+          if( NULL_TOKEN != _3rd_tok ){
+            to_many_args();
+            break;
+          }
+          machine_clear_all_watches(machine);
+          printf("Watchpoints cleared\n");
+          break;
+        }
+
+        if( LIST == _2nd_tok ){
+          if( NULL_TOKEN != _3rd_tok ){
+            to_many_args();
+            break;
+          }
+          for( int i = 0; i < MEMSIZE; i++ ){
+            char kinds = machine_examine_watch(machine, i);
+            if( kinds ){
+              printf("Watchpoint set at %o %s\n", i, watch_kinds(kinds));
+            }
+          }
+          break;
+        }
+
+        if( OCTAL_LITERAL != _2nd_tok ){
+          printf("Syntax ERROR, watch argument can be 'list', 'clear' or octal value\n");
+          break;
+        }
+
+        val = read_15bit_octal(_2nd_str);
+        if( val < 0 || val >= MEMSIZE ){
+          printf("ERROR, watchpoint outside memory\n");
+          break;
+        }
+
+        {
+          int kinds = parse_watch_kinds(_3rd_str);
+          if( kinds < 0 ){
+            printf("Syntax ERROR, watch argument can be 'clear' or any of r, w and c\n");
+            break;
+          }
+          machine_set_watch(machine, val, kinds);
+          if( kinds ){
+            printf("Watchpoint set at %o %s\n", val, watch_kinds(kinds));
+          } else {
+            printf("Watchpoint at %o cleared\n", val);
+          }
+        }
         break;
       case HALT:
 	if( NULL_TOKEN != _2nd_tok ){
@@ -738,7 +1151,7 @@ void console(void)
 	  break;
         }
 
-        machine_halt();
+        machine_halt(machine);
         break;
       case EXAMINE:
 
@@ -752,48 +1165,57 @@ void console(void)
         int start, end;
         switch(_2nd_tok) {
         case E_AC:
-          printf("AC = %o\n", machine_examine_reg(AC));
+          printf("AC = %o\n", machine_examine_reg(machine, AC));
           break;
         case E_MQ:
-          printf("MQ = %o\n", machine_examine_reg(MQ));
+          printf("MQ = %o\n", machine_examine_reg(machine, MQ));
+          break;
+        case E_SC:
+          printf("SC = %o\n", machine_examine_reg(machine, SC));
+          break;
+        case E_GT:
+          printf("GT = %o\n", machine_examine_reg(machine, GT));
+          break;
+        case E_TIME:
+          printf("TIME = %llu ns\n", examine_time());
           break;
         case E_SR:
-          printf("SR = %o\n", machine_examine_reg(SR));
+          printf("SR = %o\n", machine_examine_reg(machine, SR));
           break;
         case E_ION:
-          printf("ION = %o\n", machine_examine_reg(ION_FLAG));
+          printf("ION = %o\n", machine_examine_reg(machine, ION_FLAG));
           break;
         case E_INTR:
-          printf("INTR = %o\n", machine_examine_reg(INTR));
+          printf("INTR = %o\n", machine_examine_reg(machine, INTR));
           break;
         case E_SF:
-          printf("SF = %o\n", machine_examine_reg(SF));
+          printf("SF = %o\n", machine_examine_reg(machine, SF));
           break;
         case E_DF:
-          printf("DF = %o\n", machine_examine_reg(DF));
+          printf("DF = %o\n", machine_examine_reg(machine, DF));
           break;
         case E_IF:
-          printf("IF = %o\n", (machine_examine_reg(PC) & IF_MASK) >> 12);
+          printf("IF = %o\n", (machine_examine_reg(machine, PC) & IF_MASK) >> 12);
           break;
         case E_INHIB:
-          printf("INHIB = %o\n", machine_examine_reg(INTR_INHIBIT));
+          printf("INHIB = %o\n", machine_examine_reg(machine, INTR_INHIBIT));
           break;
         case E_IB:
-          printf("IB = %o\n", machine_examine_reg(IB));
+          printf("IB = %o\n", machine_examine_reg(machine, IB));
           break;
         case E_UF:
-          printf("UF = %o\n", machine_examine_reg(UF));
+          printf("UF = %o\n", machine_examine_reg(machine, UF));
           break;
         case E_UB:
-          printf("UB = %o\n", machine_examine_reg(UB));
+          printf("UB = %o\n", machine_examine_reg(machine, UB));
           break;
         case E_PC:
-          printf("PC = %o\n", machine_examine_reg(PC));
+          printf("PC = %o\n", machine_examine_reg(machine, PC));
           break;
         case E_TTY:
           printf("TTY keyboard: buf = %o flag = %d\n"
                  "TTY printer:  buf = %o flag = %d\n"
-                 "TTY DCR = %o\n", machine_examine_reg(TTY_KB_BUF), machine_examine_reg(TTY_KB_FLAG), machine_examine_reg(TTY_TP_BUF), machine_examine_reg(TTY_TP_FLAG), machine_examine_reg(TTY_DCR));
+                 "TTY DCR = %o\n", machine_examine_reg(machine, TTY_KB_BUF), machine_examine_reg(machine, TTY_KB_FLAG), machine_examine_reg(machine, TTY_TP_BUF), machine_examine_reg(machine, TTY_TP_FLAG), machine_examine_reg(machine, TTY_DCR));
           break;
         case E_CPU:
           print_regs();
@@ -857,36 +1279,54 @@ void console(void)
         case E_AC:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(AC, val);
-            printf("AC = %o\n", machine_examine_reg(AC));
+            machine_deposit_reg(machine, AC, val);
+            printf("AC = %o\n", machine_examine_reg(machine, AC));
           }
           break;
         case E_MQ:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(MQ,val);
-            printf("MQ = %o\n", machine_examine_reg(MQ));
+            machine_deposit_reg(machine, MQ,val);
+            printf("MQ = %o\n", machine_examine_reg(machine, MQ));
+          }
+          break;
+        case E_SC:
+          val = read_12bit_octal(_3rd_str);
+          if( val >= 0 && val <= 037 ){
+            machine_deposit_reg(machine, SC,val);
+            printf("SC = %o\n", machine_examine_reg(machine, SC));
+          } else {
+            printf("Syntax ERROR, SC can be between 0 and 037\n");
+          }
+          break;
+        case E_GT:
+          val = read_12bit_octal(_3rd_str);
+          if( val >= 0 && val <= 1 ){
+            machine_deposit_reg(machine, GT,val);
+            printf("GT = %o\n", machine_examine_reg(machine, GT));
+          } else {
+            printf("Syntax ERROR, GT can be 0 or 1\n");
           }
           break;
         case E_SR:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(SR,val);
-            printf("SR = %o\n", machine_examine_reg(SR));
+            machine_deposit_reg(machine, SR,val);
+            printf("SR = %o\n", machine_examine_reg(machine, SR));
           }
           break;
         case E_DF:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(DF,val);
-            printf("DF = %o\n", machine_examine_reg(DF));
+            machine_deposit_reg(machine, DF,val);
+            printf("DF = %o\n", machine_examine_reg(machine, DF));
           }
           break;
         case E_IF:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 && val <= 3){
-            machine_deposit_reg(PC,(((val << 12 ) & FIELD_MASK) | (machine_examine_reg(PC) & B12_MASK)));
-            printf("IF = %o\n", (machine_examine_reg(PC) & FIELD_MASK) >> 12);
+            machine_deposit_reg(machine, PC,(((val << 12 ) & FIELD_MASK) | (machine_examine_reg(machine, PC) & B12_MASK)));
+            printf("IF = %o\n", (machine_examine_reg(machine, PC) & FIELD_MASK) >> 12);
           } else {
             printf("Syntax ERROR, IF can be between 0 and 03\n");
           }
@@ -894,29 +1334,29 @@ void console(void)
         case E_PC:
           val = read_15bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(PC,val);
-            printf("PC = %o\n", machine_examine_reg(PC));
+            machine_deposit_reg(machine, PC,val);
+            printf("PC = %o\n", machine_examine_reg(machine, PC));
           }
           break;
         case E_TTY_KB_FLAG:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(TTY_KB_FLAG,val);
-            printf("TTY_KB_FLAG = %o\n", machine_examine_reg(TTY_KB_FLAG));
+            machine_deposit_reg(machine, TTY_KB_FLAG,val);
+            printf("TTY_KB_FLAG = %o\n", machine_examine_reg(machine, TTY_KB_FLAG));
           }
           break;
         case E_TTY_TP_FLAG:
           val = read_12bit_octal(_3rd_str);
           if( val >= 0 ){
-            machine_deposit_reg(TTY_TP_FLAG,val);
-            printf("TTY_TP_FLAG = %o\n", machine_examine_reg(TTY_TP_FLAG));
+            machine_deposit_reg(machine, TTY_TP_FLAG,val);
+            printf("TTY_TP_FLAG = %o\n", machine_examine_reg(machine, TTY_TP_FLAG));
           }
           break;
         case OCTAL_LITERAL:
           addr = read_15bit_octal(_2nd_str);
           val = read_12bit_octal(_3rd_str);
           if( addr >= 0 && val >= 0 ){
-            machine_deposit_mem(addr,val);
+            machine_deposit_mem(machine, addr,val);
             print_instruction(addr);
           }
           break;
@@ -937,14 +1377,46 @@ void console(void)
                  "    Set or unset breakpoint add given address, the CPU will halt when\n"
                  "    the PC reaches an address with set breakpoint.\n\n"
 
+                 "  break <octal value> <condition>[,<condition>...]\n\n"
+
+                 "    Set a breakpoint that only halts the CPU when all conditions\n"
+                 "    hold, checked by the emulator without returning to the console.\n"
+                 "    A condition compares ac, mq, df, if or the word at an octal\n"
+                 "    [F:]AAAA address with =, !=, <, <=, > or >= to an octal value,\n"
+                 "    ignore=<decimal> passes that many hits before halting and\n"
+                 "    hit=<decimal> halts on the given hit. break 1234 ac=0,hit=5000\n"
+                 "    halts the 5000th time PC reaches 1234 with AC zero.\n\n"
+
                  "  break list\n\n"
 
-                 "    List addresses of all set breakpoints.\n\n"
+                 "    List addresses of all set breakpoints, with the conditions, the\n"
+                 "    hits left to ignore and the hits so far.\n\n"
 
                  "  break clear\n\n"
 
                  "    Unset ALL breakpoints.\n\n");
           break;
+        case WATCH:
+          printf("\n  Stop when a memory word is accessed\n\n"
+                 "  watch <octal address> [rwc]\n\n"
+
+                 "    Stop after an instruction that reads (r) or writes (w) the\n"
+                 "    word, or writes a new value to it (c), by default r and w.\n"
+                 "    Operands, indirect pointers, autoindex increments and the\n"
+                 "    interrupt's store to 0 are watched, EAE operands are not.\n\n"
+
+                 "  watch <octal address> clear\n\n"
+
+                 "    Remove the watch from the word.\n\n"
+
+                 "  watch list\n\n"
+
+                 "    List all watched addresses.\n\n"
+
+                 "  watch clear\n\n"
+
+                 "    Remove ALL watches.\n\n");
+          break;
         case RUN:
           printf("\n  Start CPU execution.\n\n"
 
@@ -967,7 +1439,84 @@ void console(void)
 
                  "  trace\n\n"
 
-                 "    Turn trace ON or OFF. When ON, each executed instruction is printed.\n\n");
+                 "    Turn trace ON or OFF. When ON, each executed instruction is printed.\n\n"
+
+                 "  trace <file>\n\n"
+
+                 "    Write each executed instruction, the registers it started with\n"
+                 "    and its operand to a binary trace file, until \"trace close\".\n"
+                 "    Print it with 8trace <file>.\n\n"
+
+                 "  trace close\n\n"
+
+                 "    Stop writing the trace file.\n\n"
+
+                 "  trace filter <term>[,<term>...]\n\n"
+
+                 "    Only trace instructions that pass all terms, in both the printed\n"
+                 "    trace and trace files. A term is a PC range [<field>:]<octal\n"
+                 "    address>[-<octal address>], up to 8 of them, an instruction\n"
+                 "    class mri, iot or opr, dev=<octal device code> for IOTs to that\n"
+                 "    device only, or after=[<field>:]<octal address> to trace nothing\n"
+                 "    until the instruction at that address. E.g.\n"
+                 "    trace filter 1:200-377,iot,dev=3,after=0:200\n\n"
+
+                 "  trace filter clear\n\n"
+
+                 "    Trace all instructions again.\n\n");
+          break;
+        case STATS:
+          printf("\n  Print instruction statistics\n\n"
+
+                 "  stats\n\n"
+
+                 "    Print how many times each opcode, addressing mode, OPR bit and IOT\n"
+                 "    has executed. Only counted when built with -DCPU_STATS.\n\n"
+
+                 "  stats clear\n\n"
+
+                 "    Reset all counters to zero.\n\n");
+          break;
+        case HEATMAP:
+          printf("\n  Print memory accesses per page\n\n"
+
+                 "  heatmap\n\n"
+
+                 "    Print instruction fetches, operand reads, operand writes and\n"
+                 "    autoindex increments per 128 word page, as a grid per kind with\n"
+                 "    one row per field. Only counted when built with -DCPU_STATS and\n"
+                 "    reset by \"stats clear\".\n\n"
+
+                 "  heatmap <file>\n\n"
+
+                 "    Save the counts per page as CSV.\n\n");
+          break;
+        case COVERAGE:
+          printf("\n  Executed addresses\n\n"
+
+                 "  coverage <file>\n\n"
+
+                 "    Save a bitmap of every address an instruction has been fetched\n"
+                 "    from, 4096 bytes with address 0 in bit 0 of the first byte.\n\n"
+
+                 "  coverage list <file>\n\n"
+
+                 "    Save a disassembly of all executed or non-zero words, executed\n"
+                 "    ones marked with '*'.\n\n"
+
+                 "  coverage clear\n\n"
+
+                 "    Forget all executed addresses.\n\n");
+          break;
+        case HISTORY:
+          printf("\n  Print the last executed instructions\n\n"
+
+                 "  history [<decimal count>]\n\n"
+
+                 "    Print the PC, instruction and the AC, link and MQ it started with\n"
+                 "    for up to the last 512 instructions, oldest first. With\n"
+                 "    --history=<count> the last instructions are printed whenever\n"
+                 "    the CPU halts or hits a breakpoint or stop_at.\n\n");
           break;
         case DEPOSIT:
           printf("\n  No help yet :(\n\n");
@@ -1015,15 +1564,26 @@ void console(void)
           // current content of PC.
           print_regs();
           printf("\t\t");
-          print_instruction(machine_examine_reg(PC));
+          print_instruction(machine_examine_reg(machine, PC));
         }
 
         in_console = 0;
-        char state = machine_run( _1st_tok == STEP ? 1 : 0 );
+        char state = machine_run(machine, _1st_tok == STEP ? 1 : 0 );
         switch(state) {
         case 'B':
-          printf(" >>> BREAKPOINT HIT at %o <<<\n", machine_examine_reg(PC));
+          printf(" >>> BREAKPOINT HIT at %o <<<\n", machine_examine_reg(machine, PC));
           // TODO print_instuction
+          if( history_on_stop ){
+            print_history(history_on_stop);
+          }
+          break;
+        case 'W':
+          printf(" >>> WATCHPOINT HIT at %o, PC = %o <<<\n",
+                 machine_examine_reg(machine, WATCH_ADDR),
+                 machine_examine_reg(machine, PC));
+          if( history_on_stop ){
+            print_history(history_on_stop);
+          }
           break;
         case 'I':
         case 'H':
@@ -1031,6 +1591,9 @@ void console(void)
           print_regs();
           printf("\n");
           // TODO print_instruction
+          if( history_on_stop ){
+            print_history(history_on_stop);
+          }
           if( exit_on_HLT ){
             exit(EXIT_FAILURE);
           }
@@ -1040,6 +1603,9 @@ void console(void)
           print_regs();
           printf("\n");
           // TODO print_instruction
+          if( history_on_stop ){
+            print_history(history_on_stop);
+          }
           exit(EXIT_SUCCESS);
           break;
         case 'S':
@@ -1094,18 +1660,108 @@ void console(void)
         }
         break;
       case TRACE:
-        if( _2nd_tok != NULL_TOKEN ){
+        if( FILTER == _2nd_tok ){
+          trace_filter_t filter;
+
+          if( NULL_TOKEN == _3rd_tok ){
+            to_few_args();
+          } else if( CLEAR == _3rd_tok ){
+            memset(&filter, 0, sizeof(trace_filter_t));
+            machine_toggle_trace(machine, &filter);
+            printf("Trace filter cleared\n");
+          } else if( parse_trace_filter(_3rd_str, &filter) ){
+            machine_toggle_trace(machine, &filter);
+            printf("Trace filter set\n");
+          }
+          break;
+        }
+
+        if( NULL_TOKEN != _3rd_tok ){
           to_many_args();
           break;
         }
 
-        machine_toggle_trace();
-        if( machine_examine_trace() ){
+        if( CLOSE == _2nd_tok ){
+          machine_set_trace_file(machine, "");
+          printf("Trace file closed\n");
+          break;
+        } else if( NULL_TOKEN != _2nd_tok ){
+          if( machine_set_trace_file(machine, _2nd_str) ){
+            printf("Tracing to %s\n", _2nd_str);
+          }
+          break;
+        }
+
+        machine_toggle_trace(machine, NULL);
+        if( machine_examine_trace(machine) ){
           printf("Instruction trace ON\n");
         } else {
           printf("Instruction trace OFF\n");
         }
         break;
+      case STATS:
+        if( NULL_TOKEN != _3rd_tok ){
+          to_many_args();
+          break;
+        }
+
+        if( CLEAR == _2nd_tok ){
+          machine_clear_stats(machine);
+          printf("Statistics cleared\n");
+        } else if( NULL_TOKEN == _2nd_tok ){
+          print_stats();
+        } else {
+          printf("Syntax ERROR, stats argument can be 'clear'\n");
+        }
+        break;
+      case HEATMAP:
+        if( NULL_TOKEN != _3rd_tok ){
+          to_many_args();
+          break;
+        }
+
+        if( NULL_TOKEN == _2nd_tok ){
+          print_heatmap();
+        } else if( save_heatmap(_2nd_str) ){
+          printf("Heatmap saved\n");
+        }
+        break;
+      case COVERAGE:
+        if( NULL_TOKEN == _2nd_tok ){
+          to_few_args();
+        } else if( CLEAR == _2nd_tok ){
+          if( NULL_TOKEN != _3rd_tok ){
+            to_many_args();
+            break;
+          }
+          machine_clear_coverage(machine);
+          printf("Coverage cleared\n");
+        } else if( LIST == _2nd_tok ){
+          if( NULL_TOKEN == _3rd_tok ){
+            to_few_args();
+          } else if( list_coverage(_3rd_str) ){
+            printf("Coverage listing saved\n");
+          }
+        } else if( NULL_TOKEN != _3rd_tok ){
+          to_many_args();
+        } else if( save_coverage(_2nd_str, 0) ){
+          printf("Coverage saved\n");
+        }
+        break;
+      case HISTORY:
+        if( NULL_TOKEN != _3rd_tok ){
+          to_many_args();
+          break;
+        }
+
+        if( NULL_TOKEN == _2nd_tok ){
+          print_history(HISTORY_SIZE);
+        } else if( (val = atoi(_2nd_str)) > 0 ){
+          print_history(val);
+        } else {
+          printf("Syntax ERROR, history argument must be a count\n");
+        }
+        break;
       case TTY_ATTACH:
         if( NULL_TOKEN != _3rd_tok ){
           to_many_args();
@@ -1159,8 +1815,11 @@ void console(void)
 void exit_cleanup(void)
 {
   save_state("prev.core");
+  if( coverage_file != NULL ){
+    save_coverage(coverage_file, 1);
+  }
   tcsetattr(0, TCSANOW, &told);
-  machine_quit();
+  machine_quit(machine);
 }
 
 int save_state(char *filename)
@@ -1172,19 +1831,19 @@ int save_state(char *filename)
     return 0;
   }
 
-  short pc = machine_examine_reg(PC);
-  short ac = machine_examine_reg(AC);
-  short mq = machine_examine_reg(MQ);
-  short df = machine_examine_reg(DF);
-  __attribute__((unused)) short ib = machine_examine_reg(IB);
-  __attribute__((unused)) short uf = machine_examine_reg(UF);
-  __attribute__((unused)) short sf = machine_examine_reg(SF);
-  short sr = machine_examine_reg(SR);
-  short ion = machine_examine_reg(ION_FLAG);
-  __attribute__((unused))  short intr_inhibit = machine_examine_reg(INTR_INHIBIT);
-  short rtf_delay = machine_examine_reg(RTF_DELAY);
-  short ion_delay = machine_examine_reg(ION_DELAY);
-  short intr = machine_examine_reg(INTR);
+  short pc = machine_examine_reg(machine, PC);
+  short ac = machine_examine_reg(machine, AC);
+  short mq = machine_examine_reg(machine, MQ);
+  short df = machine_examine_reg(machine, DF);
+  __attribute__((unused)) short ib = machine_examine_reg(machine, IB);
+  __attribute__((unused)) short uf = machine_examine_reg(machine, UF);
+  __attribute__((unused)) short sf = machine_examine_reg(machine, SF);
+  short sr = machine_examine_reg(machine, SR);
+  short ion = machine_examine_reg(machine, ION_FLAG);
+  __attribute__((unused))  short intr_inhibit = machine_examine_reg(machine, INTR_INHIBIT);
+  short rtf_delay = machine_examine_reg(machine, RTF_DELAY);
+  short ion_delay = machine_examine_reg(machine, ION_DELAY);
+  short intr = machine_examine_reg(machine, INTR);
 
   // TODO save/restore more state variables
   fprintf(core, "8BALL MEM DUMP VERSION=1\n");
@@ -1202,7 +1861,7 @@ int save_state(char *filename)
       fprintf(core, "PAGE %.3o\n",p);
       for(int row=0;row <8;row++){
         for(int col=0;col<16;col++){
-          fprintf(core,"%.4o ",machine_examine_mem(i++));
+          fprintf(core,"%.4o ",machine_examine_mem(machine, i++));
         }
         fprintf(core, "\n");
       }
@@ -1221,6 +1880,62 @@ int save_state(char *filename)
 }
 
 
+// Write the bitmap of executed addresses, bit 0 of byte 0 is address
+// 00000 and bit 7 of the last byte 77777. With merge set the bits
+// already in the file are kept, so runs can add to one file.
+int save_coverage(char *filename, char merge)
+{
+  unsigned char bitmap[COVERAGE_SIZE];
+  unsigned char old[COVERAGE_SIZE];
+  FILE *fh;
+
+  machine_examine_coverage(machine, bitmap);
+  if( merge && (fh = fopen(filename, "r")) != NULL ){
+    if( fread(old, 1, COVERAGE_SIZE, fh) == COVERAGE_SIZE ){
+      for( int i = 0; i < COVERAGE_SIZE; i++ ){
+        bitmap[i] |= old[i];
+      }
+    }
+    fclose(fh);
+  }
+  fh = fopen(filename, "w");
+  if( fh == NULL ){
+    perror("Unable to open coverage file");
+    return 0;
+  }
+  if( fwrite(bitmap, 1, COVERAGE_SIZE, fh) != COVERAGE_SIZE ){
+    fclose(fh);
+    return 0;
+  }
+  return fclose(fh) == 0;
+}
+
+// Disassemble every word that was executed or is not zero, executed
+// ones marked with '*'.
+int list_coverage(char *filename)
+{
+  unsigned char bitmap[COVERAGE_SIZE];
+  int executed = 0, words = 0;
+  FILE *fh = fopen(filename, "w");
+
+  if( fh == NULL ){
+    perror("Unable to open listing file");
+    return 0;
+  }
+  machine_examine_coverage(machine, bitmap);
+  for( int pc = 0; pc < MEMSIZE; pc++ ){
+    char hit = (bitmap[pc >> 3] >> (pc & 7)) & 1;
+    if( hit || machine_examine_mem(machine, pc) ){
+      fprintf(fh, "%c ", hit ? '*' : ' ');
+      fprint_instruction(fh, pc);
+      executed += hit;
+      words++;
+    }
+  }
+  fprintf(fh, "%d of %d words executed\n", executed, words);
+  return fclose(fh) == 0;
+}
+
 int restore_state(char *filename)
 {
   FILE *core = fopen(filename, "r");
@@ -1296,21 +2011,311 @@ int restore_state(char *filename)
 
   // TODO send using machine
   for(int i=0; i<MEMSIZE; i++){
-    machine_deposit_mem(i, rmem[i]);
-  }
-  machine_deposit_reg(PC,rpc);
-  machine_deposit_reg(AC,rac);
-  machine_deposit_reg(MQ,rmq);
-  machine_deposit_reg(DF,rdf);
-  machine_deposit_reg(SR,rsr);
-  machine_deposit_reg(ION_FLAG,rion);
-  machine_deposit_reg(ION_DELAY,rion_delay);
-  machine_deposit_reg(RTF_DELAY,rrtf_delay);
-  machine_deposit_reg(INTR,rintr);
+    machine_deposit_mem(machine, i, rmem[i]);
+  }
+  machine_deposit_reg(machine, PC,rpc);
+  machine_deposit_reg(machine, AC,rac);
+  machine_deposit_reg(machine, MQ,rmq);
+  machine_deposit_reg(machine, DF,rdf);
+  machine_deposit_reg(machine, SR,rsr);
+  machine_deposit_reg(machine, ION_FLAG,rion);
+  machine_deposit_reg(machine, ION_DELAY,rion_delay);
+  machine_deposit_reg(machine, RTF_DELAY,rrtf_delay);
+  machine_deposit_reg(machine, INTR,rintr);
+  return 1;
+}
+
+
+// Run one copy of the machine for each switch register setting from
+// sweep_first to sweep_last with the batch engine and print where
+// each copy ended. Returns 0 if any copy failed verification.
+int sweep(void)
+{
+#ifdef SERVER_BUILD
+  static const char *states[] = {
+    [BATCH_RUNNING] = "RUNNING",
+    [BATCH_HALTED] = "HALTED",
+    [BATCH_STOPPED] = "STOP AT",
+    [BATCH_LIMIT] = "LIMIT",
+    [BATCH_MISMATCH] = "MISMATCH",
+  };
+  int lanes = sweep_last - sweep_first + 1;
+  batch_t *batch = batch_create(machine, lanes, sweep_verify);
+  struct timespec start, end;
+  long total;
+  int ok = 1;
+
+  if( batch == NULL ){
+    printf("Unable to create %d machines\n", lanes);
+    return 0;
+  }
+  for( int i = 0; i < lanes; i++ ){
+    machine_deposit_reg(batch_lane(batch, i), SR, sweep_first + i);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  total = batch_run(batch, sweep_limit);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  for( int i = 0; i < lanes; i++ ){
+    pdp8_machine_t *m = batch_lane(batch, i);
+    printf("SR = %.4o %-8s PC = %o AC = %o MQ = %o INSTRUCTIONS = %ld\n",
+           sweep_first + i, states[(int)batch_state(batch, i)],
+           machine_examine_reg(m, PC), machine_examine_reg(m, AC),
+           machine_examine_reg(m, MQ), batch_executed(batch, i));
+    if( batch_state(batch, i) == BATCH_MISMATCH ){
+      ok = 0;
+    }
+  }
+  double seconds = (end.tv_sec - start.tv_sec) +
+    (end.tv_nsec - start.tv_nsec) / 1e9;
+  fprintf(stderr, "%d machines, %ld instructions in %.3f s, %.1f MIPS\n",
+          lanes, total, seconds, total / seconds / 1e6);
+  batch_destroy(batch);
+  return ok;
+#else
+  printf("?? --sweep_sr is only supported by 8ball ??\n");
+  return 0;
+#endif
+}
+
+
+// [<field>:]<octal address>[-<octal address>], a range within one
+// field.
+static int parse_filter_range(char *s, unsigned int *first,
+                              unsigned int *last)
+{
+  unsigned int field = 0, a, b;
+  int n = 0;
+
+  if( sscanf(s, "%o:%n", &field, &n) == 1 && n > 0 ){
+    s += n;
+  } else {
+    field = 0;
+  }
+  n = 0;
+  if( sscanf(s, "%o%n", &a, &n) != 1 ){
+    return 0;
+  }
+  s += n;
+  b = a;
+  if( *s == '-' ){
+    n = 0;
+    if( sscanf(s + 1, "%o%n", &b, &n) != 1 ){
+      return 0;
+    }
+    s += 1 + n;
+  }
+  if( *s != '\0' || field > 7 || a > b || b > 07777 ){
+    return 0;
+  }
+  *first = field << 12 | a;
+  *last = field << 12 | b;
+  return 1;
+}
+
+// Parse the comma separated terms of "trace filter", see the help
+// text. dev= without a class only passes IOTs. Returns 0 on syntax
+// errors.
+int parse_trace_filter(char *expr, trace_filter_t *filter)
+{
+  memset(filter, 0, sizeof(trace_filter_t));
+  for( char *term = expr; term != NULL; ){
+    char *next = strchr(term, ',');
+    unsigned int first, last, dev;
+    int n = 0;
+
+    if( next != NULL ){
+      *next++ = '\0';
+    }
+    if( ! strcasecmp(term, "mri") ){
+      filter->classes |= TRACE_MRI;
+    } else if( ! strcasecmp(term, "iot") ){
+      filter->classes |= TRACE_IOT;
+    } else if( ! strcasecmp(term, "opr") ){
+      filter->classes |= TRACE_OPR;
+    } else if( sscanf(term, "dev=%o%n", &dev, &n) == 1 &&
+               term[n] == '\0' && dev <= 077 ){
+      filter->devices |= 1ULL << dev;
+    } else if( ! strncasecmp(term, "after=", 6) &&
+               parse_filter_range(term + 6, &first, &last) &&
+               first == last ){
+      filter->wait = 1;
+      filter->after = first;
+    } else if( parse_filter_range(term, &first, &last) ){
+      if( filter->ranges == TRACE_RANGES ){
+        printf("Syntax ERROR, at most %d trace filter ranges\n", TRACE_RANGES);
+        return 0;
+      }
+      filter->first[filter->ranges] = first;
+      filter->last[filter->ranges++] = last;
+    } else {
+      printf("Syntax ERROR, unknown trace filter term '%s'\n", term);
+      return 0;
+    }
+    term = next;
+  }
+  if( filter->devices && ! filter->classes ){
+    filter->classes = TRACE_IOT;
+  }
+  return 1;
+}
+
+
+static const char *bp_names[] = {
+  [BP_AC] = "ac", [BP_MQ] = "mq", [BP_DF] = "df", [BP_IF] = "if",
+};
+
+static const char *bp_ops[] = {
+  [BP_EQ] = "=", [BP_NE] = "!=", [BP_LT] = "<", [BP_LE] = "<=",
+  [BP_GT] = ">", [BP_GE] = ">=",
+};
+
+// Parse the comma separated conditions of "break", see the help text.
+// Returns 0 on syntax errors.
+int parse_bp_cond(char *expr, bp_cond_t *cond)
+{
+  memset(cond, 0, sizeof(bp_cond_t));
+  for( char *term = expr; term != NULL; ){
+    char *next = strchr(term, ',');
+    char *op = term + strcspn(term, "=!<>");
+    bp_compare_t *cmp = &cond->compare[(int)cond->compares];
+    unsigned int first, last, value;
+    long count;
+    int n = 0, i;
+
+    if( next != NULL ){
+      *next++ = '\0';
+    }
+    if( sscanf(term, "ignore=%ld%n", &count, &n) == 1 &&
+        term[n] == '\0' && count >= 0 ){
+      cond->ignore = count;
+      term = next;
+      continue;
+    }
+    if( sscanf(term, "hit=%ld%n", &count, &n) == 1 &&
+        term[n] == '\0' && count > 0 ){
+      cond->ignore = count - 1;
+      term = next;
+      continue;
+    }
+    if( cond->compares == BP_COMPARES ){
+      printf("Syntax ERROR, at most %d breakpoint compares\n", BP_COMPARES);
+      return 0;
+    }
+
+    cmp->what = -1;
+    for( i = BP_GE; i >= 0; i-- ){
+      if( ! strncmp(op, bp_ops[i], strlen(bp_ops[i])) ){
+        cmp->op = i;
+        break;
+      }
+    }
+    if( i >= 0 && sscanf(op + strlen(bp_ops[i]), "%o%n", &value, &n) == 1 &&
+        op[strlen(bp_ops[i]) + n] == '\0' && value <= 07777 ){
+      char c = *op;
+      *op = '\0';
+      for( int j = BP_AC; j <= BP_IF; j++ ){
+        if( ! strcasecmp(term, bp_names[j]) ){
+          cmp->what = j;
+        }
+      }
+      if( cmp->what < 0 && parse_filter_range(term, &first, &last) &&
+          first == last ){
+        cmp->what = BP_MEM;
+        cmp->mem = first;
+      }
+      *op = c;
+      cmp->value = value;
+    }
+    if( cmp->what < 0 ){
+      printf("Syntax ERROR, unknown breakpoint condition '%s'\n", term);
+      return 0;
+    }
+    cond->compares++;
+    term = next;
+  }
   return 1;
 }
 
 
+// Print the conditions, ignore count and hits of a breakpoint, after
+// "Breakpoint set at".
+void print_bp_cond(const bp_cond_t *cond)
+{
+  for( int i = 0; i < cond->compares; i++ ){
+    const bp_compare_t *cmp = &cond->compare[i];
+    printf(i ? "," : " if ");
+    if( cmp->what == BP_MEM ){
+      printf("%o:%.4o", cmp->mem >> 12, cmp->mem & B12_MASK);
+    } else {
+      printf("%s", bp_names[(int)cmp->what]);
+    }
+    printf("%s%o", bp_ops[(int)cmp->op], cmp->value);
+  }
+  if( cond->ignore ){
+    printf(" ignore %ld", cond->ignore);
+  }
+  if( cond->hits ){
+    printf(" hits %ld", cond->hits);
+  }
+}
+
+
+// Print a trace file, one line per instruction with the link, AC and
+// MQ it started with. The instruction is disassembled with the
+// operands the trace recorded. Returns 0 if the file could not be
+// read to the end.
+int console_decode_trace(char *filename)
+{
+#ifdef SERVER_BUILD
+  trace_t trace;
+  trace_record_t r;
+  int res;
+
+  memset(&r, 0, sizeof(trace_record_t));
+  machine = machine_setup(NULL);
+  if( ! trace_open(&trace, filename) ){
+    return 0;
+  }
+  while( (res = trace_read(&trace, &r)) == 1 ){
+    printf("%o %.4o %.4o  ", r.ac >> 12, r.ac & AC_MASK, r.mq);
+    if( r.interrupt ){
+      printf("%.5o       INTERRUPT ==> JMS to 0\n", r.pc);
+      continue;
+    }
+    machine_deposit_reg(machine, DF, r.state & 07);
+    machine_deposit_reg(machine, EAE_MODE, (r.state >> 3) & 1);
+    machine_deposit_reg(machine, GT, (r.state >> 4) & 1);
+    machine_deposit_reg(machine, ION_FLAG, (r.state >> 5) & 1);
+    machine_deposit_reg(machine, INTR, (r.state >> 6) & 1);
+    machine_deposit_reg(machine, SF, r.state >> 7);
+    machine_deposit_reg(machine, AC, r.ac);
+    machine_deposit_reg(machine, MQ, r.mq);
+    machine_deposit_mem(machine, r.pc, r.word);
+    if( (r.word & IF_MASK) <= JMP ){
+      if( r.word & I_MASK ){
+        machine_deposit_mem(machine, machine_direct_addr(machine, r.pc),
+                            r.addr & B12_MASK);
+      }
+      machine_deposit_mem(machine, machine_operand_addr(machine, r.pc, 1),
+                          r.data);
+    }
+    print_instruction(r.pc);
+  }
+  if( res == -1 ){
+    printf("?? %s ends in the middle of a record ??\n", filename);
+  }
+  trace_close(&trace);
+  return res == 0;
+#else
+  (void)filename;
+  printf("?? 8trace must be built with -DSERVER_BUILD ??\n");
+  return 0;
+#endif
+}
+
+
 void parse_options(int argc, char **argv)
 {
   while (1) {
@@ -1326,6 +2331,18 @@ void parse_options(int argc, char **argv)
       {"pc",          required_argument, 0, 'p' },
       {"run",         no_argument,       0, 'n' },
       {"pty",         required_argument, 0, 'y' },
+      {"engine",      required_argument, 0, 'g' },
+      {"speed",       required_argument, 0, 'd' },
+      {"clock",       required_argument, 0, 'c' },
+      {"warp",        no_argument,       0, 'a' },
+      {"profile",     required_argument, 0, 'f' },
+      {"callgraph",   no_argument,       0, 'k' },
+      {"coverage",    required_argument, 0, 'o' },
+      {"history",     required_argument, 0, 'i' },
+      {"trace_file",  required_argument, 0, 't' },
+      {"sweep_sr",    required_argument, 0, 'w' },
+      {"sweep_limit", required_argument, 0, 'l' },
+      {"sweep_verify", no_argument,      0, 'v' },
       {0,             0,                 0, 0 }
     };
 
@@ -1365,6 +2382,108 @@ void parse_options(int argc, char **argv)
       pty_name = optarg;
       break;
 
+    case 'g':
+      if( ! strcmp(optarg, "switch") ){
+        engine = ENGINE_SWITCH;
+      } else if( ! strcmp(optarg, "threaded") ){
+        engine = ENGINE_THREADED;
+      } else if( ! strcmp(optarg, "block") ){
+        engine = ENGINE_BLOCK;
+      } else if( ! strcmp(optarg, "aot") ){
+        engine = ENGINE_AOT;
+      } else {
+        printf("?? engine must be 'switch', 'threaded', 'block' or 'aot' ??\n");
+        exit(EXIT_FAILURE);
+      }
+      break;
+
+    case 'd':
+      if( ! strcmp(optarg, "max") ){
+        speed = 0;
+      } else if( ! strcmp(optarg, "real") ){
+        speed = 100;
+      } else {
+        double factor = strtod(optarg, &endptr);
+        if( endptr == optarg || strcmp(endptr, "x") ||
+            factor < 0.01 || factor > 327 ){
+          printf("?? speed must be 'real', 'max' or a factor, e.g. 2x or 0.5x ??\n");
+          exit(EXIT_FAILURE);
+        }
+        speed = factor * 100 + 0.5;
+      }
+      break;
+
+    case 'c':
+      clock_hz = strtol(optarg, &endptr, 10);
+      if( *endptr != '\0' || (clock_hz != 50 && clock_hz != 60) ){
+        printf("?? clock must be 50 or 60 ??\n");
+        exit(EXIT_FAILURE);
+      }
+      break;
+
+    case 'a':
+      warp = 1;
+      break;
+
+    case 'f':
+      profile = strtol(optarg, &endptr, 10);
+      if( ! strcmp(endptr, "us") ){
+        profile_flags |= PROF_PER_TIME;
+        endptr += 2;
+      }
+      if( *endptr != '\0' || profile <= 0 ||
+          profile > 0x7FFFFFFF ){
+        printf("?? profile must be a number of instructions or microseconds, e.g. 1000 or 500us ??\n");
+        exit(EXIT_FAILURE);
+      }
+      break;
+
+    case 'k':
+      profile_flags |= PROF_CALLS;
+      break;
+
+    case 'o':
+      coverage_file = optarg;
+      break;
+
+    case 't':
+      trace_file = optarg;
+      break;
+
+    case 'i':
+      history_on_stop = strtol(optarg, &endptr, 10);
+      if( *endptr != '\0' || history_on_stop <= 0 ){
+        printf("?? history must be a positive number ??\n");
+        exit(EXIT_FAILURE);
+      }
+      break;
+
+    case 'w':
+      {
+        unsigned int first, last;
+        int length = 0;
+        if( sscanf(optarg, "%o-%o%n", &first, &last, &length) != 2 ||
+            optarg[length] != '\0' || first > last || last > 07777 ){
+          printf("?? sweep_sr must be an octal range, e.g. 0-7777 ??\n");
+          exit(EXIT_FAILURE);
+        }
+        sweep_first = first;
+        sweep_last = last;
+      }
+      break;
+
+    case 'l':
+      sweep_limit = strtol(optarg, &endptr, 10);
+      if( *endptr != '\0' || sweep_limit < 0 ){
+        printf("?? sweep_limit must be a positive number ??\n");
+        exit(EXIT_FAILURE);
+      }
+      break;
+
+    case 'v':
+      sweep_verify = 1;
+      break;
+
     case '?':
       exit(EXIT_FAILURE);
       break;
@@ -12,8 +12,10 @@
 void console_setup(int argc, char **argv);
 char console_read_tty_byte(char *output);
 void console_write_tty_byte(char output);
+void console_wait_tty_input(int timeout);
 void console_stop_at(void);
 void console_trace_instruction(void);
+int console_decode_trace(char *filename);
 
 void console(void);
 
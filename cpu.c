@@ -6,50 +6,396 @@
   LICENSE file in the root directory of this source tree.
 */
 
+#define _POSIX_C_SOURCE 200112L
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
 #include "cpu.h"
 #include "tty.h"
+#include "pdp8.h"
+#ifdef AOT_BUILD
+#include "aot.h"
+#endif
 
-// TODO implement "clear" command that initializes these variables,
-// just like the clear switch on a real front panel.
-// CPU registers
-short mb = 0; // Memory Buffer
-short cpma = 0; // Central Processor Memory Address
-short pc = 0200; // Program Counter (and Instruction Field, if)
-short ac = 0; // Acumulator
-short mq = 0; // Multiplier Quotient
-short sr = 07777; // Switch Registers, 1 is switch up
-short ion = 0; // Interrupt enable flipflop
-short ion_delay = 0; //ion will be set after next fetch
-short intr = 0; // Interrupt requested flags
-// Memory extension registers
-short ib = 0; // Instruction buffer
-short sf = 0; // save field
-short df = 0; // data field
-short intr_inhibit = 0; // interrupt inhibit flag
-// Time share registers
-short uf = 0; // User Flag
-short ub = 0; // User Buffer
-// TODO remove rtf_delay
-short rtf_delay = 0; //ion will be set after next fetch
-// TODO add F D E state bits
-
-short mem[MEMSIZE];
-short breakpoints[MEMSIZE];
-
-void cpu_init(void){
+#ifndef CPU_DEFAULT_ENGINE
+#define CPU_DEFAULT_ENGINE ENGINE_SWITCH
+#endif
+
+// Predecoded instructions, a shadow array beside mem[]. An entry is
+// decoded the first time the word is fetched and thrown away when the
+// word is written, so decoding is paid once per store instead of once
+// per fetch.
+typedef enum opclass {
+  OP_UNDECODED = 0,
+  OP_AND,
+  OP_TAD,
+  OP_ISZ,
+  OP_DCA,
+  OP_JMS,
+  OP_JMP,
+  OP_IOT,
+  OP_OPR1,
+  OP_OPR2,
+  OP_OPR3,
+} opclass_t;
+
+#define D_INDIRECT  01
+#define D_AUTOINDEX 02
+
+// OPR micro-operations. decode() turns the microcoded bits of an OPR
+// instruction into a sequence of these, in the order the hardware
+// applies them, so the threaded engine never tests bits one at a
+// time. The group two tests only note that a condition holds, the
+// sense of the skip is applied by UOP_SKIP or UOP_SKIP_INV.
+typedef enum uop {
+  UOP_END = 0,
+  UOP_CLA,
+  UOP_CLL,
+  UOP_CMA,
+  UOP_CML,
+  UOP_IAC,
+  UOP_RAR,
+  UOP_RTR,
+  UOP_RAL,
+  UOP_RTL,
+  UOP_BSW,
+  UOP_TEST_MINUS, // SMA or SPA
+  UOP_TEST_ZERO,  // SZA or SNA
+  UOP_TEST_LINK,  // SNL or SZL
+  UOP_SKIP,       // OR group, skip if any condition holds
+  UOP_SKIP_INV,   // AND group, skip if no condition holds
+  UOP_PRIV,       // OSR and HLT trap in user mode
+  UOP_OSR,
+  UOP_HLT,
+  UOP_SWP,
+  UOP_MQA,
+  UOP_MQL,
+  UOP_EAE,        // the rest of group three, see eae()
+} uop_t;
+
+#define UOP_MAX 10
+
+typedef struct decoded {
+  char op;    // opcode class, selects the handler in cpu_process()
+  char flags; // D_INDIRECT and D_AUTOINDEX
+  short addr; // direct address, only valid for MRIs
+  short time; // cpu_instruction_time()
+  char uops[UOP_MAX]; // micro-op sequence, only valid for OPR
+} decoded_t;
+
+// Basic blocks translated by the block engine. A block is a straight
+// run of instructions within one 128 word page, ending at a JMP, JMS,
+// skip, page boundary or before an IOT or breakpoint. Blocks are
+// invalidated a page at a time by bumping the page generation when a
+// word covered by a translation is written.
+#define BLOCK_MAX 32
+
+typedef struct block {
+  unsigned int gen; // page generation at translation
+  short len;
+  struct {
+    short mb;
+    decoded_t d;
+  } insn[BLOCK_MAX];
+} block_t;
+
+// Per machine engine state, allocated by cpu_create()
+struct cpu_cache {
+  decoded_t decoded[MEMSIZE];
+  block_t *blocks[MEMSIZE];
+  unsigned int page_gen[PAGES];
+  char translated[MEMSIZE]; // word is covered by a translation
+};
+
+// The interrupt is a forced JMS to location 0 of field 0.
+static const decoded_t intr_jms = {
+  OP_JMS, 0, 0, T_FAST_CYCLE + T_SLOW_CYCLE, { UOP_END }
+};
+
+
+// Allocate a new machine and initialize it with cpu_init(). Returns
+// NULL if out of memory.
+pdp8_machine_t *cpu_create(void)
+{
+  pdp8_machine_t *m = NULL;
+
+  if( posix_memalign((void **)&m, 64, sizeof(pdp8_machine_t)) ){
+    return NULL;
+  }
+  if( ! cpu_setup(m) ){
+    free(m);
+    return NULL;
+  }
+  return m;
+}
+
+
+// Like cpu_create() for a machine in memory owned by the caller, who
+// frees it after cpu_release(). Returns 0 if out of memory.
+char cpu_setup(pdp8_machine_t *m)
+{
+  memset(m, 0, sizeof(pdp8_machine_t));
+  m->cache = calloc(1, sizeof(struct cpu_cache));
+  if( m->cache == NULL ){
+    return 0;
+  }
+  m->engine = CPU_DEFAULT_ENGINE;
+  m->internal_stop_at = -1;
+  m->trace.fd = -1;
+  cpu_init(m);
+  return 1;
+}
+
+
+void cpu_destroy(pdp8_machine_t *m)
+{
+  cpu_release(m);
+  free(m);
+}
+
+
+// Free everything cpu_setup() allocated.
+void cpu_release(pdp8_machine_t *m)
+{
+  prof_stop(m);
+  for( int i = 0; i < MEMSIZE; i++ ){
+    free(m->cache->blocks[i]);
+  }
+  free(m->cache);
+}
+
+
+void cpu_init(pdp8_machine_t *m){
+  short *mem = m->mem; // For rimloader.h
   int i;
   for( i=0 ; i<MEMSIZE; i++){
     mem[i] = 0;
-    breakpoints[i] = 0;
+    m->breakpoints[i] = 0;
+    m->cache->decoded[i].op = OP_UNDECODED;
+  }
+  memset(m->bp_conds, 0, sizeof(m->bp_conds));
+  for( i=0 ; i<PAGES; i++){
+    cpu_invalidate_page(m, i << 7);
   }
 #include "rimloader.h"
-  pc = 07756;
+  m->pc = 07756;
+  m->if_base = 0;
+  m->sr = 07777;
+  m->time = 0;
+  event_reset(m);
+  clk_set_frequency(m, 60);
+  clk_reset(m);
+}
+
+
+// All stores to memory must go through here so the predecoded entry
+// of the written word is invalidated.
+void cpu_store_mem(pdp8_machine_t *m, short addr, short val)
+{
+  m->mem[addr] = val;
+  m->cache->decoded[addr].op = OP_UNDECODED;
+  if( m->cache->translated[addr] ){
+    cpu_invalidate_page(m, addr);
+  }
+}
+
+
+// Throw away all translated blocks in the page of addr. Also used
+// when a breakpoint or stop_at is set, since blocks never run past
+// one.
+void cpu_invalidate_page(pdp8_machine_t *m, short addr)
+{
+  short first = addr & (FIELD_MASK|PAGE_MASK);
+  m->cache->page_gen[PAGE_OF(addr)]++;
+  for( int i = 0; i <= WORD_MASK; i++ ){
+    m->cache->translated[first + i] = 0;
+  }
+}
+
+
+static void decode_opr(decoded_t *d, short word)
+{
+  char *u = d->uops;
+
+  switch( d->op ){
+  case OP_OPR1:
+    if( word & CLA ) *u++ = UOP_CLA;
+    if( word & CLL ) *u++ = UOP_CLL;
+    if( word & CMA ) *u++ = UOP_CMA;
+    if( word & CML ) *u++ = UOP_CML;
+    if( word & IAC ) *u++ = UOP_IAC;
+    if( word & RAR ) *u++ = (word & BSW) ? UOP_RTR : UOP_RAR;
+    if( word & RAL ) *u++ = (word & BSW) ? UOP_RTL : UOP_RAL;
+    if( (word & (RAR|RAL|BSW)) == BSW ) *u++ = UOP_BSW;
+    break;
+  case OP_OPR2:
+    // SMA/SPA, SZA/SNA and SNL/SZL share bit positions.
+    if( word & SMA ) *u++ = UOP_TEST_MINUS;
+    if( word & SZA ) *u++ = UOP_TEST_ZERO;
+    if( word & SNL ) *u++ = UOP_TEST_LINK;
+    if( word & CLA ) *u++ = UOP_CLA;
+    *u++ = (word & OPR_AND) ? UOP_SKIP_INV : UOP_SKIP;
+    if( word & (OSR|HLT) ) *u++ = UOP_PRIV;
+    if( word & OSR ) *u++ = UOP_OSR;
+    if( word & HLT ) *u++ = UOP_HLT;
+    break;
+  case OP_OPR3:
+    if( word & CLA ) *u++ = UOP_CLA;
+    if( (word & MQA) && (word & MQL) ){
+      *u++ = UOP_SWP;
+    } else {
+      if( word & MQA ) *u++ = UOP_MQA;
+      if( word & MQL ) *u++ = UOP_MQL;
+    }
+    if( word & (SCA|EAE_OP_MASK) ) *u++ = UOP_EAE;
+    break;
+  }
+  *u = UOP_END;
+}
+
+
+static decoded_t *decode(pdp8_machine_t *m, short addr)
+{
+  decoded_t *d = &m->cache->decoded[addr];
+  short word = m->mem[addr];
+
+  d->flags = 0;
+  d->addr = 0;
+
+  switch( word & IF_MASK ){
+  case AND: d->op = OP_AND; break;
+  case TAD: d->op = OP_TAD; break;
+  case ISZ: d->op = OP_ISZ; break;
+  case DCA: d->op = OP_DCA; break;
+  case JMS: d->op = OP_JMS; break;
+  case JMP: d->op = OP_JMP; break;
+  case IOT: d->op = OP_IOT; break;
+  case OPR:
+    if( ! (word & OPR_G2) ){
+      d->op = OP_OPR1;
+    } else if( ! (word & OPR_G3) ){
+      d->op = OP_OPR2;
+    } else {
+      d->op = OP_OPR3;
+    }
+    break;
+  }
+  decode_opr(d, word);
+
+  if( (word & IF_MASK) <= JMP ){
+    // Only MRIs have an operand address. An IOT that happens to have
+    // the indirect bit set must not be flagged as autoindexing.
+    d->addr = direct_addr(addr, word);
+    if( word & I_MASK ){
+      d->flags |= D_INDIRECT;
+      if( (d->addr & (PAGE_MASK|WORD_MASK)) >= 010
+          &&
+          (d->addr & (PAGE_MASK|WORD_MASK)) <= 017 ){
+        d->flags |= D_AUTOINDEX;
+      }
+    }
+  }
+  d->time = cpu_instruction_time(addr, word);
+
+  return d;
+}
+
+
+// Execution time in nanoseconds of the instruction word at pc on a
+// PDP-8/E: a fast memory cycle for FETCH and one for DEFER, plus a
+// slow EXECUTE cycle for AND, TAD, ISZ, DCA, JMS and IOTs. Autoindexing
+// stretches DEFER. eae() adds the time of the EAE steps.
+short cpu_instruction_time(short pc, short word)
+{
+  short t = T_FAST_CYCLE;
+  short addr;
+
+  if( (word & IF_MASK) <= JMP ){
+    if( (word & IF_MASK) != JMP ){
+      t += T_SLOW_CYCLE;
+    }
+    if( word & I_MASK ){
+      t += T_FAST_CYCLE;
+      addr = direct_addr(pc, word) & (PAGE_MASK|WORD_MASK);
+      if( addr >= 010 && addr <= 017 ){
+        t += T_AUTOINDEX;
+      }
+    }
+  } else if( (word & IF_MASK) == IOT ){
+    t += T_SLOW_CYCLE;
+  }
+  return t;
+}
+
+
+#ifdef CPU_STATS
+// Count the instruction word fetched from pc in m->stats[].
+void cpu_count(pdp8_machine_t *m, short pc, short word)
+{
+  short addr;
+  int group, bit;
+
+  m->stats[STAT_OPCODE((word & IF_MASK) >> 9)]++;
+  m->stats[STAT_HEAT(HEAT_FETCH, PAGE_OF(pc))]++;
+  switch( word & IF_MASK ){
+  case IOT:
+    m->stats[STAT_IOT((word & DEV_MASK) >> 3, word & IOT_OP_MASK)]++;
+    break;
+  case OPR:
+    if( ! (word & OPR_G2) ){
+      group = 1;
+    } else {
+      group = (word & OPR_G3) ? 3 : 2;
+    }
+    // Bit 0 tells group two and three apart
+    for( bit = group == 1 ? 0 : 1; bit < 8; bit++ ){
+      if( word & (1 << bit) ){
+        m->stats[STAT_OPR(group, bit)]++;
+      }
+    }
+    break;
+  default:
+    addr = direct_addr(pc, word);
+    if( ! (word & I_MASK) ){
+      m->stats[STAT_DIRECT]++;
+    } else if( (addr & (PAGE_MASK|WORD_MASK)) >= 010 &&
+               (addr & (PAGE_MASK|WORD_MASK)) <= 017 ){
+      m->stats[STAT_AUTOINDEX]++;
+      m->stats[STAT_HEAT(HEAT_AUTOINDEX, PAGE_OF(addr))]++;
+      addr = ((word & IF_MASK) < JMS ? m->df_base : m->if_base) |
+        INC_12BIT(m->mem[addr]);
+    } else {
+      m->stats[STAT_INDIRECT]++;
+      m->stats[STAT_HEAT(HEAT_READ, PAGE_OF(addr))]++;
+      addr = ((word & IF_MASK) < JMS ? m->df_base : m->if_base) |
+        (m->mem[addr] & B12_MASK);
+    }
+    switch( word & IF_MASK ){
+    case ISZ:
+      m->stats[STAT_HEAT(HEAT_WRITE, PAGE_OF(addr))]++;
+      // Fall through
+    case AND:
+    case TAD:
+      m->stats[STAT_HEAT(HEAT_READ, PAGE_OF(addr))]++;
+      break;
+    case JMS:
+      if( m->intr_inhibit ){
+        addr = m->ib << 12 | (addr & B12_MASK);
+      }
+      // Fall through
+    case DCA:
+      m->stats[STAT_HEAT(HEAT_WRITE, PAGE_OF(addr))]++;
+      break;
+    }
+    break;
+  }
 }
+#endif
 
 
-short direct_addr(short pc)
+// The direct address of the MRI word fetched from pc.
+short direct_addr(short pc, short cur)
 {
-  short cur = *(mem+pc);
   short addr = 0;
 
   if( cur & Z_MASK ){
@@ -67,10 +413,10 @@ short direct_addr(short pc)
 
 // Memory access modifies some magic addresses. If "examine" is
 // non-zero, no modification is done.
-short operand_addr(short pc, char examine)
+short operand_addr(pdp8_machine_t *m, short pc, char examine)
 {
-  short cur = *(mem+pc);
-  short addr = direct_addr(pc);
+  short cur = *(m->mem+pc);
+  short addr = direct_addr(pc, cur);
 
   if( cur & I_MASK ){
     // indirect addressing
@@ -80,503 +426,1562 @@ short operand_addr(short pc, char examine)
         &&
         ! examine ){
       // autoindex addressing
-      mem[addr] = INC_12BIT(mem[addr]);
+      cpu_store_mem(m, addr, INC_12BIT(m->mem[addr]));
+    }
+    addr = (addr & FIELD_MASK) | (m->mem[addr] & B12_MASK);
+  }
+  return addr;
+}
+
+
+void cpu_raise_interrupt(pdp8_machine_t *m, short flag)
+{
+  m->intr |= flag;
+}
+
+
+// IOT instructions are shared by all engines, and used by the batch
+// engine. m->mb holds the instruction and m->pc is already incremented.
+void cpu_iot(pdp8_machine_t *m)
+{
+  if( m->uf ){ // IOT is a privileged instruction, interrupt
+    m->intr |= UINTR_FLAG;
+    return;
+  }
+  switch( (m->mb & DEV_MASK) >> 3 ){
+  case 00: // Interrupt control
+    switch( m->mb & IOT_OP_MASK ){
+    case SKON:
+      if( m->ion ){
+        m->pc = INC_PC(m->pc);
+        m->ion = 0;
+      }
+      break;
+    case ION:
+      m->ion_delay = 1;
+      break;
+    case IOF:
+      m->ion = 0;
+      break;
+    case SRQ:
+      if( m->intr ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case GTF:
+      // Small Computer Handbook from -73 says intr_inhibit is saved
+      // by GTF. But MAINDEC-8E-D1HA explicitly tests the opposite.
+      m->ac = (m->ac & LINK_MASK) | // preserve LINK
+        (((m->ac & LINK_MASK) >> 12) << 11) | (m->gt << 10) | ((m->intr ? 1:0) << 9) | (m->ion << 7) | m->sf; // Remember that UF stored in SF on an 8/E
+      break;
+    case RTF:
+      // RTF allways sets ION irregardless of the ION bit in AC.
+      m->ion = 1;
+      m->intr_inhibit = 1;
+      m->ac = ((m->ac << 1) & LINK_MASK) | (m->ac & AC_MASK); //restore LINK bit.
+      m->ib = (m->ac & 070) >> 3;
+      m->df = m->ac & 07;
+      m->df_base = m->df << 12;
+      m->ub = (m->ac & 0100) >> 6;
+      m->gt = (m->ac & 02000) >> 10;
+      break;
+    case SGT:
+      if( m->gt ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case CAF:
+      // TODO reset supported devices. Reset MMU interrupt inhibit flipflop
+      tty_reset(m);
+      clk_reset(m);
+      m->ac = m->ion = m->intr = 0;
+      m->eae_b = m->gt = 0; // The EAE starts in mode A
+      break;
+    }
+    break;
+    // KL8E (device code 03 and 04)
+  case 03: // Console tty input
+    switch( m->mb & IOT_OP_MASK ){
+    case KCF:
+      m->tty.kb_flag = 0;
+      m->intr = m->intr & ~TTYI_INTR_FLAG;
+      break;
+    case KSF:
+      if( m->tty.kb_flag ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case KCC:
+      m->tty.kb_flag = 0;
+      m->intr = m->intr & ~TTYI_INTR_FLAG;
+      m->ac &= LINK_MASK;
+      break;
+    case KRS:
+      m->ac |= (m->tty.kb_buf & B8_MASK);
+      break;
+    case KIE:
+      m->tty.dcr = m->ac & TTY_IE_MASK; // Write IE bit of ac to DCR (SE not supported).
+      break;
+    case KRB:
+      m->tty.kb_flag = 0;
+      m->intr = m->intr & ~TTYI_INTR_FLAG;
+      m->ac &= LINK_MASK;
+      m->ac |= (m->tty.kb_buf & B8_MASK);
+      break;
+    default:
+      // TODO optionally go to console
+      //printf("illegal IOT instruction. device 03 - keyboard\n");
+      break;
+    }
+    break;
+  case 04: // Console tty output
+    switch( m->mb & IOT_OP_MASK ){
+    case TFL:
+      m->tty.tp_flag = 1;
+      if( m->tty.dcr & TTY_IE_MASK ){
+        m->intr |= TTYO_INTR_FLAG;
+      }
+      break;
+    case TSF:
+      if( m->tty.tp_flag ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case TCF:
+      m->tty.tp_flag = 0;
+      m->intr &= ~TTYO_INTR_FLAG;
+      break;
+    case TPC:
+      m->tty.tp_buf = (m->ac & B7_MASK); // emulate ASR with 7M1
+      tty_initiate_output(m);
+      break;
+    case TSK:
+      if( m->tty.tp_flag || m->tty.kb_flag ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case TLS:
+      m->tty.tp_buf = (m->ac & B7_MASK); // emulate ASR with 7M1
+      tty_initiate_output(m);
+      m->tty.tp_flag = 0;
+      m->intr &= ~TTYO_INTR_FLAG;
+      break;
+    default:
+      // TODO optionally go to console
+      //printf("illegal IOT instruction. device 04 - TTY output\n");
+      break;
+    }
+    break;
+  case 013: // DK8-EA line frequency clock
+    switch( m->mb & IOT_OP_MASK ){
+    case CLEI:
+      clk_enable_interrupt(m, 1);
+      break;
+    case CLDI:
+      clk_enable_interrupt(m, 0);
+      break;
+    case CLSC:
+      if( clk_skip_flag(m) ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    }
+    break;
+  case 020: // Memory Management instructions, the last three bits
+  case 021: // is the memory field being read or set.
+  case 022:
+  case 023:
+  case 024:
+  case 025:
+  case 026:
+  case 027:
+    switch( m->mb & IOT_OP_MASK ){
+    case CDF: // Change field instructions
+    case CIF:
+    case CDI:
+      {
+        short field = (m->mb & MMU_DI_MASK) >> 3;
+        short iot = m->mb & IOT_OP_MASK;
+        if( iot & CDF ){
+          m->df = field;
+          m->df_base = field << 12;
+        }
+
+        if( iot & CIF ){
+          m->ib = field;
+          m->intr_inhibit = 1;
+        }
+      }
+      break;
+    case 04: // READ instruction group
+      switch( m->mb & MMU_DI_MASK ){
+      case CINT:
+        m->intr &= ~UINTR_FLAG;
+        break;
+      case RDF:
+        m->ac |= (m->df << 3);
+        break;
+      case RIF:
+        m->ac |= m->if_base >> 9;
+        break;
+      case RIB:
+        m->ac |= m->sf;
+        break;
+      case RMF:
+        m->ib = (m->sf & 070) >> 3;
+        m->df = (m->sf & 07);
+        m->df_base = m->df << 12;
+        m->ub = (m->sf & 0100) >> 6;
+        m->intr_inhibit = 1;
+        break;
+      case SINT:
+        if( m->intr & UINTR_FLAG ){
+          m->pc = INC_PC(m->pc);
+        }
+        break;
+      case CUF:
+        m->ub = 0;
+        m->intr_inhibit = 1;
+        break;
+      case SUF:
+        m->ub = 1;
+        m->intr_inhibit = 1;
+        break;
+      default:
+        // TODO optionally go to console
+        //printf("IOT unsupported memory management instruction(04): NOP\n");
+        break;
+      }
+      break;
+    default:
+      // TODO optionally go to console
+      //printf("IOT unsupported memory management instruction: NOP\n");
+      break;
     }
-    addr = (addr & FIELD_MASK) | (mem[addr] & B12_MASK);
+    break;
+  default:
+    // TODO optionally go to console
+    //printf("IOT to unknown device: %.3o. Treating as NOP\n", (mb & DEV_MASK) >> 3);
+    // DEV 01 High speed paper tape reader
+    // DEV 02 High speed paper tape punch
+    // DEV 10
+    // 01 and 04 -> MP8, memory parity
+    // 02 -> KP8, pwr fail & restart
+    break;
+  }
+}
+
+
+// Address of the operand of an EAE instruction, the word after the
+// instruction in mode A. In mode B that word holds the address of the
+// operand in the current data field. Skips PC past the word.
+static short eae_operand_addr(pdp8_machine_t *m)
+{
+  short addr = m->pc;
+
+  m->pc = INC_PC(m->pc);
+  if( m->eae_b ){
+    addr = m->df_base | (m->mem[addr] & B12_MASK);
   }
   return addr;
 }
 
 
-void cpu_raise_interrupt(short flag)
+// Number of left shifts that normalize the 24 bit AC:MQ in v, that is
+// until AC0 and AC1 differ. Zero is left alone.
+static int eae_normalize_shifts(int v)
+{
+  if( v == 0 ){
+    return 0;
+  }
+#ifdef __GNUC__
+  return __builtin_clrsb((int)((unsigned int)v << 8) >> 8) - 8;
+#else
+  int n = 0;
+  while( ((v >> 23) & 1) == ((v >> 22) & 1) && n < 23 ){
+    v <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+
+// KE8E Extended Arithmetic Element, the part of a group three OPR that
+// follows CLA, MQA and MQL. Shared by all engines. Multiply, divide
+// and the shifts work on AC:MQ as one 24 bit host integer, with AC as
+// the high half.
+static void eae(pdp8_machine_t *m)
 {
-  intr |= flag;
+  short code = (m->mb & (SCA|EAE_OP_MASK)) >> 1;
+  short addr, n;
+  int v;
+
+  if( m->mb == SWAB ){
+    m->eae_b = 1;
+    return;
+  }
+
+  if( m->eae_b && code > 020 ){
+    // Mode B only, SCA is part of the operation code.
+    switch( code ){
+    case 021: // DAD, double precision add
+      m->time += 2 * T_FAST_CYCLE + 2 * T_SLOW_CYCLE;
+      addr = eae_operand_addr(m);
+      v = (m->mq & B12_MASK) + m->mem[addr];
+      addr = (addr & FIELD_MASK) | INC_12BIT(addr);
+      m->ac = ((m->ac & AC_MASK) + m->mem[addr] + (v >> 12)) & LINK_AC_MASK;
+      m->mq = v & B12_MASK;
+      break;
+    case 022: // DST, double precision store
+      m->time += 2 * T_FAST_CYCLE + 2 * T_SLOW_CYCLE;
+      addr = eae_operand_addr(m);
+      cpu_store_mem(m, addr, m->mq & B12_MASK);
+      addr = (addr & FIELD_MASK) | INC_12BIT(addr);
+      cpu_store_mem(m, addr, m->ac & AC_MASK);
+      break;
+    case 023: // SWBA
+      m->eae_b = m->gt = 0;
+      break;
+    case 024: // DPSZ, double precision skip if zero
+      if( ! (m->ac & AC_MASK) && ! (m->mq & B12_MASK) ){
+        m->pc = INC_PC(m->pc);
+      }
+      break;
+    case 025: // DPIC, double precision increment. MQA MQL already
+              // swapped, the low half is in AC.
+      v = ((m->mq & B12_MASK) << 12 | (m->ac & AC_MASK)) + 1;
+      m->ac = ((m->ac & LINK_MASK) + (v >> 12)) & LINK_AC_MASK;
+      m->mq = v & B12_MASK;
+      break;
+    case 026: // DCM, double precision complement. Swapped like DPIC.
+      v = (m->mq & B12_MASK) << 12 | (m->ac & AC_MASK);
+      if( v == 0 ){
+        m->ac ^= LINK_MASK; // The carry out complements the link, like CIA
+      }
+      v = -v;
+      m->ac = (m->ac & LINK_MASK) | ((v >> 12) & AC_MASK);
+      m->mq = v & B12_MASK;
+      break;
+    case 027: // SAM, subtract AC from MQ
+      {
+        short ac = m->ac & AC_MASK;
+        short mq = m->mq & B12_MASK;
+        m->ac = (mq + (ac ^ AC_MASK) + 1) & LINK_AC_MASK;
+        m->gt = (ac <= mq) ^ ((ac ^ mq) >> 11); // MQ >= AC, signed
+      }
+      break;
+    }
+    return;
+  }
+
+  if( code & 020 ){
+    // SCA
+    m->ac |= m->sc;
+  }
+
+  switch( code & 07 ){
+  case 0:
+    break;
+  case 1:
+    if( m->eae_b ){
+      // ACS, AC to step counter
+      m->sc = m->ac & 037;
+      m->ac &= LINK_MASK;
+    } else {
+      // SCL, step counter load from the complement of the next word
+      m->sc = ~m->mem[m->pc] & 037;
+      m->pc = INC_PC(m->pc);
+      m->time += T_FAST_CYCLE;
+    }
+    break;
+  case 2: // MUY, AC:MQ = MQ * operand + AC
+    addr = eae_operand_addr(m);
+    v = (m->mq & B12_MASK) * m->mem[addr] + (m->ac & AC_MASK);
+    m->ac = (v >> 12) & AC_MASK;
+    m->mq = v & B12_MASK;
+    m->sc = 014;
+    m->time += T_FAST_CYCLE * (1 + m->eae_b) + 12 * T_EAE_STEP;
+    break;
+  case 3: // DVI, MQ = AC:MQ / operand, AC = remainder
+    addr = eae_operand_addr(m);
+    if( (m->ac & AC_MASK) >= m->mem[addr] ){
+      // Divide overflow, also divide by zero
+      m->ac |= LINK_MASK;
+      m->mq = ((m->mq << 1) + 1) & B12_MASK;
+      m->sc = 0;
+    } else {
+      v = (m->ac & AC_MASK) << 12 | (m->mq & B12_MASK);
+      m->mq = v / m->mem[addr];
+      m->ac = v % m->mem[addr];
+      m->sc = 015;
+    }
+    m->time += T_FAST_CYCLE * (1 + m->eae_b) + 13 * T_EAE_STEP;
+    break;
+  case 4: // NMI, normalize
+    v = (m->ac & AC_MASK) << 12 | (m->mq & B12_MASK);
+    n = eae_normalize_shifts(v);
+    if( n > 0 ){
+      // The link gets the last bit shifted out of AC0, the sign.
+      m->ac = (v & 040000000) ? LINK_MASK : 0;
+      v = (v << n) & 077777777;
+    }
+    m->ac = (m->ac & LINK_MASK) | (v >> 12);
+    m->mq = v & B12_MASK;
+    if( m->eae_b && v == 040000000 ){
+      m->ac &= LINK_MASK;
+    }
+    m->sc = n & 037;
+    m->time += n * T_EAE_STEP;
+    break;
+  case 5: // SHL, shift L:AC:MQ left
+    n = (m->mem[m->pc] & 037) + ! m->eae_b; // One more in mode A
+    m->pc = INC_PC(m->pc);
+    {
+      unsigned int u = (m->ac & LINK_AC_MASK) << 12 | (m->mq & B12_MASK);
+      u = n > 25 ? 0 : u << n;
+      m->ac = (u >> 12) & LINK_AC_MASK;
+      m->mq = u & B12_MASK;
+    }
+    m->sc = m->eae_b ? 037 : 0;
+    m->time += T_FAST_CYCLE + n * T_EAE_STEP;
+    break;
+  case 6: // ASR, arithmetic shift right, the link gets the sign
+    n = (m->mem[m->pc] & 037) + ! m->eae_b;
+    m->pc = INC_PC(m->pc);
+    v = (m->ac & AC_MASK) << 12 | (m->mq & B12_MASK);
+    v = (int)((unsigned int)v << 8) >> 8; // Sign extend
+    if( m->eae_b && n > 0 ){
+      m->gt = (v >> (n - 1)) & 1; // The last bit shifted out
+    }
+    v = v >> (n > 25 ? 25 : n);
+    m->ac = (v >> 12) & LINK_AC_MASK;
+    m->mq = v & B12_MASK;
+    m->sc = m->eae_b ? 037 : 0;
+    m->time += T_FAST_CYCLE + n * T_EAE_STEP;
+    break;
+  case 7: // LSR, logical shift right, clears the link
+    n = (m->mem[m->pc] & 037) + ! m->eae_b;
+    m->pc = INC_PC(m->pc);
+    v = (m->ac & AC_MASK) << 12 | (m->mq & B12_MASK);
+    if( m->eae_b && n > 0 ){
+      m->gt = (v >> (n - 1)) & 1;
+    }
+    v = n > 24 ? 0 : v >> n;
+    m->ac = (v >> 12) & AC_MASK;
+    m->mq = v & B12_MASK;
+    m->sc = m->eae_b ? 037 : 0;
+    m->time += T_FAST_CYCLE + n * T_EAE_STEP;
+    break;
+  }
 }
 
 
-int cpu_process()
+// Handles interrupts and the FETCH (and DEFER) major states common to
+// all engines. Returns the predecoded instruction to execute, with
+// cpma set to its effective address.
+static const decoded_t *fetch(pdp8_machine_t *m)
 {
-  if( ion && intr && (! intr_inhibit) ){
+  const decoded_t *d;
+
+  if( m->ion && m->intr && (! m->intr_inhibit) ){
     // An interrupt occured, disable interrupts, force JMS to 0000
-    mb = JMS;
-    cpma = 0;
+    d = &intr_jms;
+    m->mb = JMS;
+    m->cpma = 0;
     // ion_delay is zeroed to prevent a just executed ION to turn on
     // interrupts in the middle of an interrupt handler.
-    ion = ion_delay = 0;
+    m->ion = m->ion_delay = 0;
     // Save KM8E registers
-    sf = (uf << 6) | (pc & FIELD_MASK) >> 9 | df;
-    pc = pc & B12_MASK; // Clear the field bits
-    df = ib = 0;
-    uf = ub = 0;
+    m->sf = (m->uf << 6) | m->if_base >> 9 | m->df;
+    m->pc = m->pc & B12_MASK; // Clear the field bits
+    m->df = m->ib = 0;
+    m->if_base = m->df_base = 0;
+    m->uf = m->ub = 0;
   } else {
     // No interrupt, enter TS1 of FETCH major state
-    mb = *(mem+pc);
-
-    if( (mb & IF_MASK) <= JMP ){
-      // Only calculate cpma if the current instruction is a Memory
-      // Referencing Instruction (MRI). Otherwise an instruction that
-      // happens to address an autoindexing location _and_ have the
-      // indirect bit set (e.g. 6410) will ruin that location.
-      cpma = operand_addr(pc, 0);
+    m->mb = *(m->mem+m->pc);
+    CPU_COUNT(m, m->pc, m->mb);
+    COVERAGE_SET(m, m->pc);
+    HISTORY_ADD(m, m->pc, m->mb, m->ac, m->mq);
+    d = &m->cache->decoded[m->pc];
+    if( d->op == OP_UNDECODED ){
+      d = decode(m, m->pc);
     }
-    // TODO add watch on memory cells
 
-    if( (mb & I_MASK) && (mb & IF_MASK) < JMS ){
+    // The direct address is only meaningful for Memory Referencing
+    // Instructions (MRI). decode() never flags an IOT or OPR as
+    // indirect, so an instruction that happens to address an
+    // autoindexing location _and_ have the indirect bit set (e.g.
+    // 6410) will not ruin that location.
+    m->cpma = d->addr;
+    if( d->flags & D_INDIRECT ){
+      if( d->flags & D_AUTOINDEX ){
+        cpu_store_mem(m, m->cpma, INC_12BIT(m->mem[m->cpma]));
+      }
       // For indirect AND, TAD, ISZ and DCA the field is set by DF.
-      // For JMP and JMS it is already set by IF.
-      // For IOT and OPR it doesn't matter.
-      cpma = (cpma & B12_MASK) | (df << 12);
+      // For JMP and JMS it is IF.
+      m->cpma = (d->op < OP_JMS ? m->df_base : m->if_base) |
+        (m->mem[m->cpma] & B12_MASK);
     }
 
     // Don't increment PC in case of an interrupt. An interrupt
     // actually occurs at the end of an execution cycle, before
     // the next fetch cycle.
-    pc = INC_PC(pc); // PC is incremented after fetch, so JMS works :)
+    m->pc = m->if_base | INC_12BIT(m->pc); // PC is incremented after fetch, so JMS works :)
   }
+  m->time += d->time;
 
-  if( ion_delay ){
+  if( m->ion_delay ){
     // ION is not set until the following instruction has been
     // fetched.
-    ion = 1;
-    ion_delay=0;
+    m->ion = 1;
+    m->ion_delay=0;
   }
 
-  if( rtf_delay ){
+  if( m->rtf_delay ){
     // RTF has been executed and ION is not restored until the
     // following instruction has been fetched.
-    ion = 1; // RTF always sets ION.
-    rtf_delay=0;
+    m->ion = 1; // RTF always sets ION.
+    m->rtf_delay=0;
   }
 
+  return d;
+}
+
 
-  switch( mb & IF_MASK ){
-  case AND:
+static int cpu_process_switch(pdp8_machine_t *m)
+{
+  const decoded_t *d = fetch(m);
+
+  switch( d->op ){
+  case OP_AND:
     // AND AC and operand, preserve LINK.
-    ac &= (mem[cpma] | LINK_MASK);
+    m->ac &= (m->mem[m->cpma] | LINK_MASK);
     break;
-  case TAD:
+  case OP_TAD:
     // Two complements add of AC and operand.
     // TODO: Sign extension
-    ac = (ac + mem[cpma]) & LINK_AC_MASK;
+    m->ac = (m->ac + m->mem[m->cpma]) & LINK_AC_MASK;
     break;
-  case ISZ:
+  case OP_ISZ:
     // Skip next instruction if operand is zero.
-    mem[cpma] = INC_12BIT(mem[cpma]);
-    if( mem[cpma] == 0 ){
-      pc = INC_PC(pc);
+    cpu_store_mem(m, m->cpma, INC_12BIT(m->mem[m->cpma]));
+    if( m->mem[m->cpma] == 0 ){
+      m->pc = INC_PC(m->pc);
     }
     break;
-  case DCA:
+  case OP_DCA:
     // Deposit and Clear AC
-    mem[cpma] = (ac & AC_MASK);
-    ac = (ac & LINK_MASK);
+    cpu_store_mem(m, m->cpma, m->ac & AC_MASK);
+    m->ac = (m->ac & LINK_MASK);
     break;
-  case JMS:
-    if( intr_inhibit ){
+  case OP_JMS:
+    if( m->intr_inhibit ){
       // restore IF and UF
-      pc = (ib << 12) | (pc & B12_MASK);
-      cpma = (ib << 12) | (cpma & B12_MASK);
-      uf = ub;
-      intr_inhibit = 0;
+      m->if_base = m->ib << 12;
+      m->cpma = m->if_base | (m->cpma & B12_MASK);
+      m->uf = m->ub;
+      m->intr_inhibit = 0;
     }
     // Jump and store return address.
-    mem[cpma] = (pc & B12_MASK);
-    pc = (pc & FIELD_MASK) | INC_12BIT(cpma);
+    cpu_store_mem(m, m->cpma, m->pc & B12_MASK);
+    m->pc = m->if_base | INC_12BIT(m->cpma);
     break;
-  case JMP:
-    if( intr_inhibit ){
+  case OP_JMP:
+    if( m->intr_inhibit ){
       // restore IF and UF
-      cpma = (ib << 12) | (cpma & B12_MASK);
-      uf = ub;
-      intr_inhibit = 0;
+      m->if_base = m->ib << 12;
+      m->cpma = m->if_base | (m->cpma & B12_MASK);
+      m->uf = m->ub;
+      m->intr_inhibit = 0;
     }
     // Unconditional Jump
-    pc = cpma;
+    m->pc = m->cpma;
     break;
-  case IOT:
-    if( uf ){ // IOT is a privileged instruction, interrupt
-      intr |= UINTR_FLAG;
-      break;
+  case OP_IOT:
+    cpu_iot(m);
+    break;
+  case OP_OPR1:
+    // Group one
+    if( m->mb & CLA ){
+      // CLear Accumulator
+      m->ac &= LINK_MASK; 
+    }
+
+    if( m->mb & CLL ){
+      // CLear Link
+      m->ac &= AC_MASK;
+    }
+
+    if( m->mb & CMA ){
+      // Complement AC
+      m->ac = m->ac ^ AC_MASK;
+    }
+
+    if( m->mb & CML ){
+      // Complement Link
+      m->ac = m->ac ^ LINK_MASK;
     }
-    switch( (mb & DEV_MASK) >> 3 ){
-    case 00: // Interrupt control
-      switch( mb & IOT_OP_MASK ){
-      case SKON:
-        if( ion ){
-          pc = INC_PC(pc);
-          ion = 0;
+
+    if( m->mb & IAC ){
+      // Increment ACcumulator and LINK
+      m->ac = (m->ac+1) & LINK_AC_MASK;
+    }
+
+    if( m->mb & RAR ){
+      // Rotate Accumulator Right
+      char i = 1;
+      if( m->mb & BSW ){
+        // Rotate Twice Right (RTR)
+        i = 2;
+      }
+      for( ; i > 0; i-- ){
+        char lsb = m->ac & 0b1;
+        m->ac = m->ac >> 1;
+        if( lsb ){
+          m->ac |= LINK_MASK;
+        } else {
+          m->ac &= ~LINK_MASK;
         }
-        break;
-      case ION:
-        ion_delay = 1;
-        break;
-      case IOF:
-        ion = 0;
-        break;
-      case SRQ:
-        if( intr ){
-          pc = INC_PC(pc);
-        }
-        break;
-      case GTF:
-        // TODO add more fields as support is added. (GT to AC1)
-        // Small Computer Handbook from -73 says intr_inhibit is saved
-        // by GTF. But MAINDEC-8E-D1HA explicitly tests the opposite.
-        ac = (ac & LINK_MASK) | // preserve LINK
-          (LINK << 11) | ((intr ? 1:0) << 9) | (ion << 7) | sf; // Remember that UF stored in SF on an 8/E
-        break;
-      case RTF:
-        // RTF allways sets ION irregardless of the ION bit in AC.
-        ion = 1;
-        intr_inhibit = 1;
-        ac = ((ac << 1) & LINK_MASK) | (ac & AC_MASK); //restore LINK bit.
-        ib = (ac & 070) >> 3;
-        df = ac & 07;
-        ub = (ac & 0100) >> 6;
-        // TODO restore more fields. (GT);
-        break;
-      case SGT:
-        // TODO add with EAE support
-        break;
-      case CAF:
-        // TODO reset supported devices. Reset MMU interrupt inhibit flipflop
-        tty_reset();
-        ac = ion = intr = 0;
-        break;
       }
-      break;
-      // KL8E (device code 03 and 04)
-    case 03: // Console tty input
-      switch( mb & IOT_OP_MASK ){
-      case KCF:
-        tty_kb_flag = 0;
-        intr = intr & ~TTYI_INTR_FLAG;
-        break;
-      case KSF:
-        if( tty_kb_flag ){
-          pc = INC_PC(pc);
-        }
-        break;
-      case KCC:
-        tty_kb_flag = 0;
-        intr = intr & ~TTYI_INTR_FLAG;
-        ac &= LINK_MASK;
-        break;
-      case KRS:
-        ac |= (tty_kb_buf & B8_MASK);
-        break;
-      case KIE:
-        tty_dcr = ac & TTY_IE_MASK; // Write IE bit of ac to DCR (SE not supported).
-        break;
-      case KRB:
-        tty_kb_flag = 0;
-        intr = intr & ~TTYI_INTR_FLAG;
-        ac &= LINK_MASK;
-        ac |= (tty_kb_buf & B8_MASK);
-        break;
-      default:
-        // TODO optionally go to console
-        //printf("illegal IOT instruction. device 03 - keyboard\n");
-        break;
+    }
+
+    if( m->mb & RAL ){
+      // Rotate Accumulator Left
+      char i = 1;
+      if( m->mb & BSW ){
+        // Rotate Twice Left (RTL)
+        i = 2;
       }
-      break;
-    case 04: // Console tty output
-      switch( mb & IOT_OP_MASK ){
-      case TFL:
-        tty_tp_flag = 1;
-        if( tty_dcr & TTY_IE_MASK ){
-          intr |= TTYO_INTR_FLAG;
-        }
-        break;
-      case TSF:
-        if( tty_tp_flag ){
-          pc = INC_PC(pc);
-        }
-        break;
-      case TCF:
-        tty_tp_flag = 0;
-        intr &= ~TTYO_INTR_FLAG;
-        break;
-      case TPC:
-        tty_tp_buf = (ac & B7_MASK); // emulate ASR with 7M1
-        tty_initiate_output();
-        break;
-      case TSK:
-        if( tty_tp_flag || tty_kb_flag ){
-          pc = INC_PC(pc);
+      for( ; i > 0; i-- ){
+        short msb = m->ac & LINK_MASK;
+        m->ac = (m->ac << 1) & LINK_AC_MASK;
+        if( msb ){
+          m->ac |= 1;
+        } else {
+          m->ac &= ~1;
         }
-        break;
-      case TLS:
-        tty_tp_buf = (ac & B7_MASK); // emulate ASR with 7M1
-        tty_initiate_output();
-        tty_tp_flag = 0;
-        intr &= ~TTYO_INTR_FLAG;
-        break;
-      default:
-        // TODO optionally go to console
-        //printf("illegal IOT instruction. device 04 - TTY output\n");
-        break;
       }
-      break;
-    case 020: // Memory Management instructions, the last three bits
-    case 021: // is the memory field being read or set.
-    case 022:
-    case 023:
-    case 024:
-    case 025:
-    case 026:
-    case 027:
-      switch( mb & IOT_OP_MASK ){
-      case CDF: // Change field instructions
-      case CIF:
-      case CDI:
-        {
-          short field = (mb & MMU_DI_MASK) >> 3;
-          short iot = mb & IOT_OP_MASK;
-          if( iot & CDF ){
-            df = field;
-          }
+    }
 
-          if( iot & CIF ){
-            ib = field;
-            intr_inhibit = 1;
-          }
-        }
-        break;
-      case 04: // READ instruction group
-        switch( mb & MMU_DI_MASK ){
-        case CINT:
-          intr &= ~UINTR_FLAG;
-          break;
-        case RDF:
-          ac |= (df << 3);
-          break;
-        case RIF:
-          ac |= (pc & FIELD_MASK) >> 9;
-          break;
-        case RIB:
-          ac |= sf;
-          break;
-        case RMF:
-          ib = (sf & 070) >> 3;
-          df = (sf & 07);
-          ub = (sf & 0100) >> 6;
-          intr_inhibit = 1;
-          break;
-        case SINT:
-          if( intr & UINTR_FLAG ){
-            pc = INC_PC(pc);
-          }
-          break;
-        case CUF:
-          ub = 0;
-          intr_inhibit = 1;
-          break;
-        case SUF:
-          ub = 1;
-          intr_inhibit = 1;
-          break;
-        default:
-          // TODO optionally go to console
-          //printf("IOT unsupported memory management instruction(04): NOP\n");
-          break;
-        }
-        break;
-      default:
-        // TODO optionally go to console
-        //printf("IOT unsupported memory management instruction: NOP\n");
-        break;
-      }
-      break;
-    default:
-      // TODO optionally go to console
-      //printf("IOT to unknown device: %.3o. Treating as NOP\n", (mb & DEV_MASK) >> 3);
-      // DEV 01 High speed paper tape reader
-      // DEV 02 High speed paper tape punch
-      // DEV 10
-      // 01 and 04 -> MP8, memory parity
-      // 02 -> KP8, pwr fail & restart
-      break;
+    if( ( m->mb & (RAR|RAL|BSW) ) == BSW ){
+      // Byte Swap.
+      short msb = (m->ac & 07700) >> 6;
+      short lsb = (m->ac & 00077) << 6;
+      m->ac = (m->ac & LINK_MASK) | msb | lsb;
     }
+
+    // TODO if RTR|RTL then AC = link | cpma & 7600 + mb & 0177
+    // TODO if RAR|RAL then AC = link | mb
     break;
-  case OPR:
-    if( ! (mb & OPR_G2) ){
-      // Group one
-      if( mb & CLA ){
-        // CLear Accumulator
-        ac &= LINK_MASK; 
+  case OP_OPR2:
+    // Group two
+    if( ! (m->mb & OPR_AND) ) {
+      // OR group
+      char do_skip = 0;
+
+      if( m->mb & SMA && m->ac & SIGN_BIT_MASK ){
+        // Skip if Minus Accumulator
+        do_skip = 1;
+      }
+
+      if( m->mb & SZA && ! (m->ac & AC_MASK) ){
+        // Skip if Zero Accumulator
+        do_skip = 1;
       }
 
-      if( mb & CLL ){
-        // CLear Link
-        ac &= AC_MASK;
+      if( m->mb & SNL && (m->ac & LINK_MASK ) ){
+        // Skip if Nonzero Link
+        do_skip = 1;
       }
 
-      if( mb & CMA ){
-        // Complement AC
-        ac = ac ^ AC_MASK;
+      if( m->mb & CLA ){
+        // CLear Accumulator
+        m->ac = m->ac & LINK_MASK;
       }
- 
-      if( mb & CML ){
-        // Complement Link
-        ac = ac ^ LINK_MASK;
+
+      if( do_skip ){
+        m->pc = INC_PC(m->pc);
       }
 
-      if( mb & IAC ){
-        // Increment ACcumulator and LINK
-        ac = (ac+1) & LINK_AC_MASK;
+    } else {
+      // AND group
+
+      // Assume we will skip
+      char spa_skip = 1;
+      char sna_skip = 1;
+      char szl_skip = 1;
+
+      if( m->mb & SPA && m->ac & SIGN_BIT_MASK ){
+        // Skip if Positive Accumulator
+        // Test for negative accumulator
+        spa_skip = 0;
       }
 
-      if( mb & RAR ){
-        // Rotate Accumulator Right
-        char i = 1;
-        if( mb & BSW ){
-          // Rotate Twice Right (RTR)
-          i = 2;
-        }
-        for( ; i > 0; i-- ){
-          char lsb = ac & 0b1;
-          ac = ac >> 1;
-          if( lsb ){
-            ac |= LINK_MASK;
-          } else {
-            ac &= ~LINK_MASK;
-          }
-        }
+      if( m->mb & SNA && !(m->ac & AC_MASK) ){
+        // Skip if Nonzero Accumulator
+        // Test for zero accumlator
+        sna_skip = 0;
       }
 
-      if( mb & RAL ){
-        // Rotate Accumulator Left
-        char i = 1;
-        if( mb & BSW ){
-          // Rotate Twice Left (RTL)
-          i = 2;
-        }
-        for( ; i > 0; i-- ){
-          short msb = ac & LINK_MASK;
-          ac = (ac << 1) & LINK_AC_MASK;
-          if( msb ){
-            ac |= 1;
-          } else {
-            ac &= ~1;
-          }
-        }
+      if( m->mb & SZL && m->ac & LINK_MASK ){
+        // Skip if Zero Link
+        // Test for nonzero link
+        szl_skip = 0;
       }
 
-      if( ( mb & (RAR|RAL|BSW) ) == BSW ){
-        // Byte Swap.
-        short msb = (ac & 07700) >> 6;
-        short lsb = (ac & 00077) << 6;
-        ac = (ac & LINK_MASK) | msb | lsb;
+      if( m->mb & CLA ){
+        // CLear Accumulator
+        m->ac = m->ac & LINK_MASK;
       }
 
-      // TODO if RTR|RTL then AC = link | cpma & 7600 + mb & 0177
-      // TODO if RAR|RAL then AC = link | mb
+      if( spa_skip && sna_skip && szl_skip ){
+        m->pc = INC_PC(m->pc);
+      }
+    }
+    if( m->uf && ( m->mb & (OSR | HLT) ) ){ // OSR & HLT is privileged instructions, interrupt
+      m->intr |= UINTR_FLAG;
+      break;
+    }
+    if( m->mb & OSR ){
+      m->ac |= m->sr;
+    }
+    if( m->mb & HLT ){
+      return -1;
+    }
+    break;
+  case OP_OPR3:
+    // Group Three
+    if( m->mb & CLA ){
+      // CLear Accumulator
+      m->ac = m->ac & LINK_MASK;
+    }
 
+    if( (m->mb & MQA) && (m->mb & MQL) ){
+      // Swap ac and mq
+      short tmp = m->mq & B12_MASK;
+      m->mq = m->ac & AC_MASK;
+      m->ac = (m->ac & LINK_MASK) | tmp;
     } else {
-      if( ! (mb & OPR_G3 ) ){
-        // Group two
-        if( ! (mb & OPR_AND) ) {
-          // OR group
-          char do_skip = 0;
-
-          if( mb & SMA && ac & SIGN_BIT_MASK ){
-            // Skip if Minus Accumulator
-            do_skip = 1;
-          }
+      // Otherwise apply MQA or MQL separately
+      if( m->mb & MQA ){
+        m->ac = m->ac | (m->mq & B12_MASK);
+      }
 
-          if( mb & SZA && ! (ac & AC_MASK) ){
-            // Skip if Zero Accumulator
-            do_skip = 1;
-          }
+      if( m->mb & MQL ){
+        m->mq = m->ac & AC_MASK;
+        m->ac = m->ac & LINK_MASK;
+      }
+    }
 
-          if( mb & SNL && (ac & LINK_MASK ) ){
-            // Skip if Nonzero Link
-            do_skip = 1;
-          }
- 
-          if( mb & CLA ){
-            // CLear Accumulator
-            ac = ac & LINK_MASK;
-          }
+    if( m->mb & (SCA|EAE_OP_MASK) ){
+      // Extended Arithmetic Element
+      eae(m);
+    }
+    break;
+  default:
+    break;
+  }
+  return 0;
+}
 
-          if( do_skip ){
-            pc = INC_PC(pc);
-          }
 
-        } else {
-          // AND group
+#ifdef __GNUC__
+// The threaded engine dispatches on the predecoded class and runs OPR
+// instructions as their micro-op sequence, using GCC computed gotos
+// ("labels as values") instead of switch statements. It must stay bit
+// exact with cpu_process_switch().
+static int cpu_process_threaded(pdp8_machine_t *m)
+{
+  static void * const op_label[] = {
+    [OP_UNDECODED] = &&op_end,
+    [OP_AND] = &&op_and,
+    [OP_TAD] = &&op_tad,
+    [OP_ISZ] = &&op_isz,
+    [OP_DCA] = &&op_dca,
+    [OP_JMS] = &&op_jms,
+    [OP_JMP] = &&op_jmp,
+    [OP_IOT] = &&op_iot,
+    [OP_OPR1] = &&op_opr,
+    [OP_OPR2] = &&op_opr,
+    [OP_OPR3] = &&op_opr,
+  };
+  static void * const uop_label[] = {
+    [UOP_END] = &&op_end,
+    [UOP_CLA] = &&uop_cla,
+    [UOP_CLL] = &&uop_cll,
+    [UOP_CMA] = &&uop_cma,
+    [UOP_CML] = &&uop_cml,
+    [UOP_IAC] = &&uop_iac,
+    [UOP_RAR] = &&uop_rar,
+    [UOP_RTR] = &&uop_rtr,
+    [UOP_RAL] = &&uop_ral,
+    [UOP_RTL] = &&uop_rtl,
+    [UOP_BSW] = &&uop_bsw,
+    [UOP_TEST_MINUS] = &&uop_test_minus,
+    [UOP_TEST_ZERO] = &&uop_test_zero,
+    [UOP_TEST_LINK] = &&uop_test_link,
+    [UOP_SKIP] = &&uop_skip,
+    [UOP_SKIP_INV] = &&uop_skip_inv,
+    [UOP_PRIV] = &&uop_priv,
+    [UOP_OSR] = &&uop_osr,
+    [UOP_HLT] = &&uop_hlt,
+    [UOP_SWP] = &&uop_swp,
+    [UOP_MQA] = &&uop_mqa,
+    [UOP_MQL] = &&uop_mql,
+    [UOP_EAE] = &&uop_eae,
+  };
+  const decoded_t *d = fetch(m);
+  const char *u = d->uops;
+  char cond = 0;
 
-          // Assume we will skip
-          char spa_skip = 1;
-          char sna_skip = 1;
-          char szl_skip = 1;
+#define NEXT_UOP goto *uop_label[(int)*u++]
 
-          if( mb & SPA && ac & SIGN_BIT_MASK ){
-            // Skip if Positive Accumulator
-            // Test for negative accumulator
-            spa_skip = 0;
-          }
+  goto *op_label[(int)d->op];
 
-          if( mb & SNA && !(ac & AC_MASK) ){
-            // Skip if Nonzero Accumulator
-            // Test for zero accumlator
-            sna_skip = 0;
-          }
+ op_and:
+  m->ac &= (m->mem[m->cpma] | LINK_MASK);
+  return 0;
+ op_tad:
+  m->ac = (m->ac + m->mem[m->cpma]) & LINK_AC_MASK;
+  return 0;
+ op_isz:
+  cpu_store_mem(m, m->cpma, INC_12BIT(m->mem[m->cpma]));
+  if( m->mem[m->cpma] == 0 ){
+    m->pc = INC_PC(m->pc);
+  }
+  return 0;
+ op_dca:
+  cpu_store_mem(m, m->cpma, m->ac & AC_MASK);
+  m->ac = (m->ac & LINK_MASK);
+  return 0;
+ op_jms:
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    m->cpma = m->if_base | (m->cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  cpu_store_mem(m, m->cpma, m->pc & B12_MASK);
+  m->pc = m->if_base | INC_12BIT(m->cpma);
+  return 0;
+ op_jmp:
+  if( m->intr_inhibit ){
+    m->if_base = m->ib << 12;
+    m->cpma = m->if_base | (m->cpma & B12_MASK);
+    m->uf = m->ub;
+    m->intr_inhibit = 0;
+  }
+  m->pc = m->cpma;
+  return 0;
+ op_iot:
+  cpu_iot(m);
+  return 0;
+ op_opr:
+  NEXT_UOP;
 
-          if( mb & SZL && ac & LINK_MASK ){
-            // Skip if Zero Link
-            // Test for nonzero link
-            szl_skip = 0;
-          }
+ uop_cla:
+  m->ac &= LINK_MASK;
+  NEXT_UOP;
+ uop_cll:
+  m->ac &= AC_MASK;
+  NEXT_UOP;
+ uop_cma:
+  m->ac ^= AC_MASK;
+  NEXT_UOP;
+ uop_cml:
+  m->ac ^= LINK_MASK;
+  NEXT_UOP;
+ uop_iac:
+  m->ac = (m->ac + 1) & LINK_AC_MASK;
+  NEXT_UOP;
+ uop_rtr:
+  m->ac = (m->ac >> 1) | ((m->ac & 1) << 12);
+  // fall through
+ uop_rar:
+  m->ac = (m->ac >> 1) | ((m->ac & 1) << 12);
+  NEXT_UOP;
+ uop_rtl:
+  m->ac = ((m->ac << 1) & LINK_AC_MASK) | (m->ac >> 12);
+  // fall through
+ uop_ral:
+  m->ac = ((m->ac << 1) & LINK_AC_MASK) | (m->ac >> 12);
+  NEXT_UOP;
+ uop_bsw:
+  m->ac = (m->ac & LINK_MASK) | ((m->ac & 07700) >> 6) | ((m->ac & 00077) << 6);
+  NEXT_UOP;
+ uop_test_minus:
+  cond |= (m->ac & SIGN_BIT_MASK) != 0;
+  NEXT_UOP;
+ uop_test_zero:
+  cond |= (m->ac & AC_MASK) == 0;
+  NEXT_UOP;
+ uop_test_link:
+  cond |= (m->ac & LINK_MASK) != 0;
+  NEXT_UOP;
+ uop_skip:
+  if( cond ){
+    m->pc = INC_PC(m->pc);
+  }
+  NEXT_UOP;
+ uop_skip_inv:
+  if( ! cond ){
+    m->pc = INC_PC(m->pc);
+  }
+  NEXT_UOP;
+ uop_priv:
+  if( m->uf ){ // OSR & HLT is privileged instructions, interrupt
+    m->intr |= UINTR_FLAG;
+    return 0;
+  }
+  NEXT_UOP;
+ uop_osr:
+  m->ac |= m->sr;
+  NEXT_UOP;
+ uop_hlt:
+  return -1;
+ uop_swp:
+  {
+    short tmp = m->mq & B12_MASK;
+    m->mq = m->ac & AC_MASK;
+    m->ac = (m->ac & LINK_MASK) | tmp;
+  }
+  NEXT_UOP;
+ uop_mqa:
+  m->ac |= (m->mq & B12_MASK);
+  NEXT_UOP;
+ uop_mql:
+  m->mq = m->ac & AC_MASK;
+  m->ac &= LINK_MASK;
+  NEXT_UOP;
+ uop_eae:
+  eae(m);
+  NEXT_UOP;
 
-          if( mb & CLA ){
-            // CLear Accumulator
-            ac = ac & LINK_MASK;
-          }
+ op_end:
+  return 0;
+#undef NEXT_UOP
+}
+#endif
+
+
+static block_t *translate(pdp8_machine_t *m, short start)
+{
+  block_t *b = m->cache->blocks[start];
+  short addr = start;
+
+  if( b == NULL ){
+    b = malloc(sizeof(block_t));
+    if( b == NULL ){
+      return NULL;
+    }
+    m->cache->blocks[start] = b;
+  }
+  b->gen = m->cache->page_gen[PAGE_OF(start)];
+  b->len = 0;
+
+  while( b->len < BLOCK_MAX ){
+    decoded_t *d = &m->cache->decoded[addr];
+    if( d->op == OP_UNDECODED ){
+      d = decode(m, addr);
+    }
+
+    if( d->op == OP_IOT ){
+      break; // IOTs are left to cpu_process()
+    }
+    if( d->op == OP_OPR3 && (m->mem[addr] & (SCA|EAE_OP_MASK)) ){
+      break; // So are EAE instructions, they may read the next word
+    }
+    if( b->len > 0 && m->breakpoints[addr] ){
+      break; // machine_run() must get to check the breakpoint
+    }
+
+    b->insn[b->len].mb = m->mem[addr];
+    b->insn[b->len].d = *d;
+    b->len++;
+    m->cache->translated[addr] = 1;
+
+    if( d->op == OP_ISZ || d->op == OP_JMS || d->op == OP_JMP ||
+        d->op == OP_OPR2 ){
+      break; // May change the flow of control
+    }
+    if( (addr & WORD_MASK) == WORD_MASK ){
+      break; // Blocks don't cross pages
+    }
+    addr++;
+  }
+
+  return b;
+}
+
+
+// The block engine runs a translated block with the registers kept in
+// local variables. It returns to the caller after the block, as soon
+// as a store has invalidated the block it is running, or when the
+// event deadline is reached. Interrupts and IOTs are handled by
+// falling back to cpu_process() for one instruction. count holds the
+// most instructions to run on entry, and is set to the number of
+// executed instructions.
+int cpu_process_block(pdp8_machine_t *m, int *count)
+{
+  int budget = *count;
+
+  *count = 1;
+
+  if( (m->ion && m->intr && (! m->intr_inhibit)) || m->ion_delay || m->rtf_delay ){
+    return cpu_process(m);
+  }
+
+#ifdef AOT_BUILD
+  if( m->engine == ENGINE_AOT ){
+    // Run code translated ahead of time by 8aot. A block returns with
+    // count set to zero if it has been modified since translation, or
+    // doesn't fit in the budget or before the event deadline.
+    const aot_block_fn *page = aot_pages[PAGE_OF(m->pc)];
+    if( page != NULL && page[m->pc & WORD_MASK] != NULL ){
+      int res;
+      *count = budget;
+      res = page[m->pc & WORD_MASK](m, count);
+      if( *count > 0 ){
+        return res;
+      }
+    }
+    *count = 1;
+    return cpu_process(m);
+  }
+#endif
+
+  block_t *b = m->cache->blocks[m->pc];
+  if( b == NULL || b->gen != m->cache->page_gen[PAGE_OF(m->pc)] ){
+    b = translate(m, m->pc);
+  }
+  if( b == NULL || b->len == 0 ){
+    return cpu_process(m);
+  }
 
-          if( spa_skip && sna_skip && szl_skip ){
-            pc = INC_PC(pc);
+  short lac = m->ac;
+  short lmq = m->mq;
+  short lpc = m->pc;
+  short lcpma = 0;
+  const unsigned int *gen = &m->cache->page_gen[PAGE_OF(m->pc)];
+  int len = b->len < budget ? b->len : budget;
+  int res = 0;
+  int i;
+
+  for( i = 0; i < len; i++ ){
+    const decoded_t *d = &b->insn[i].d;
+
+    CPU_COUNT(m, lpc, b->insn[i].mb);
+    COVERAGE_SET(m, lpc);
+    HISTORY_ADD(m, lpc, b->insn[i].mb, lac, lmq);
+    m->time += d->time;
+    lcpma = d->addr;
+    if( d->flags & D_INDIRECT ){
+      if( d->flags & D_AUTOINDEX ){
+        cpu_store_mem(m, lcpma, INC_12BIT(m->mem[lcpma]));
+      }
+      lcpma = (d->op < OP_JMS ? m->df_base : m->if_base) |
+        (m->mem[lcpma] & B12_MASK);
+    }
+    lpc = m->if_base | INC_12BIT(lpc);
+
+    switch( d->op ){
+    case OP_AND:
+      lac &= (m->mem[lcpma] | LINK_MASK);
+      break;
+    case OP_TAD:
+      lac = (lac + m->mem[lcpma]) & LINK_AC_MASK;
+      break;
+    case OP_ISZ:
+      cpu_store_mem(m, lcpma, INC_12BIT(m->mem[lcpma]));
+      if( m->mem[lcpma] == 0 ){
+        lpc = INC_PC(lpc);
+      }
+      break;
+    case OP_DCA:
+      cpu_store_mem(m, lcpma, lac & AC_MASK);
+      lac &= LINK_MASK;
+      break;
+    case OP_JMS:
+      if( m->intr_inhibit ){
+        m->if_base = m->ib << 12;
+        lcpma = m->if_base | (lcpma & B12_MASK);
+        m->uf = m->ub;
+        m->intr_inhibit = 0;
+      }
+      cpu_store_mem(m, lcpma, lpc & B12_MASK);
+      lpc = m->if_base | INC_12BIT(lcpma);
+      break;
+    case OP_JMP:
+      if( m->intr_inhibit ){
+        m->if_base = m->ib << 12;
+        lcpma = m->if_base | (lcpma & B12_MASK);
+        m->uf = m->ub;
+        m->intr_inhibit = 0;
+      }
+      lpc = lcpma;
+      break;
+    case OP_OPR1:
+    case OP_OPR2:
+    case OP_OPR3:
+      {
+        const char *u = d->uops;
+        char cond = 0;
+        char done = 0;
+        while( *u != UOP_END && ! done ){
+          switch( *u++ ){
+          case UOP_CLA: lac &= LINK_MASK; break;
+          case UOP_CLL: lac &= AC_MASK; break;
+          case UOP_CMA: lac ^= AC_MASK; break;
+          case UOP_CML: lac ^= LINK_MASK; break;
+          case UOP_IAC: lac = (lac + 1) & LINK_AC_MASK; break;
+          case UOP_RTR:
+            lac = (lac >> 1) | ((lac & 1) << 12);
+            // fall through
+          case UOP_RAR:
+            lac = (lac >> 1) | ((lac & 1) << 12);
+            break;
+          case UOP_RTL:
+            lac = ((lac << 1) & LINK_AC_MASK) | (lac >> 12);
+            // fall through
+          case UOP_RAL:
+            lac = ((lac << 1) & LINK_AC_MASK) | (lac >> 12);
+            break;
+          case UOP_BSW:
+            lac = (lac & LINK_MASK) | ((lac & 07700) >> 6) | ((lac & 00077) << 6);
+            break;
+          case UOP_TEST_MINUS: cond |= (lac & SIGN_BIT_MASK) != 0; break;
+          case UOP_TEST_ZERO: cond |= (lac & AC_MASK) == 0; break;
+          case UOP_TEST_LINK: cond |= (lac & LINK_MASK) != 0; break;
+          case UOP_SKIP:
+            if( cond ){
+              lpc = INC_PC(lpc);
+            }
+            break;
+          case UOP_SKIP_INV:
+            if( ! cond ){
+              lpc = INC_PC(lpc);
+            }
+            break;
+          case UOP_PRIV:
+            if( m->uf ){ // OSR & HLT is privileged instructions, interrupt
+              m->intr |= UINTR_FLAG;
+              done = 1;
+            }
+            break;
+          case UOP_OSR: lac |= m->sr; break;
+          case UOP_HLT:
+            res = -1;
+            done = 1;
+            break;
+          case UOP_SWP:
+            {
+              short tmp = lmq & B12_MASK;
+              lmq = lac & AC_MASK;
+              lac = (lac & LINK_MASK) | tmp;
+            }
+            break;
+          case UOP_MQA: lac |= (lmq & B12_MASK); break;
+          case UOP_MQL:
+            lmq = lac & AC_MASK;
+            lac &= LINK_MASK;
+            break;
           }
         }
-        if( uf && ( mb & (OSR | HLT) ) ){ // OSR & HLT is privileged instructions, interrupt
-          intr |= UINTR_FLAG;
-          break;
-        }
-        if( mb & OSR ){
-          ac |= sr;
-        }
-        if( mb & HLT ){
-          return -1;
+      }
+      break;
+    }
+
+    if( res || *gen != b->gen || m->time >= m->deadline ){
+      // Halted, self modifying code changed this page, or an event is
+      // due.
+      i++;
+      break;
+    }
+  }
+
+  m->mb = b->insn[i-1].mb;
+  m->cpma = lcpma;
+  m->ac = lac;
+  m->mq = lmq;
+  m->pc = lpc;
+  *count = i;
+  return res;
+}
+
+
+char cpu_set_engine(pdp8_machine_t *m, cpu_engine_t engine)
+{
+  switch( engine ){
+  case ENGINE_SWITCH:
+  case ENGINE_BLOCK:
+#ifdef AOT_BUILD
+  case ENGINE_AOT:
+#endif
+#ifdef __GNUC__
+  case ENGINE_THREADED:
+#endif
+    m->engine = engine;
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+
+// Execute one instruction with the switch engine and check the words
+// it reads and writes against m->watches[]. An address on a page
+// without watches costs a single bit test. A hit sets ATTN_WATCH in
+// m->attention after the instruction, with the address in
+// m->watch_addr.
+static int process_watched(pdp8_machine_t *m)
+{
+  static const char access[] = {
+    [AND >> 9] = WATCH_READ, [TAD >> 9] = WATCH_READ,
+    [ISZ >> 9] = WATCH_READ|WATCH_WRITE, [DCA >> 9] = WATCH_WRITE,
+    [JMS >> 9] = WATCH_WRITE, [JMP >> 9] = 0,
+  };
+  short word = m->mem[m->pc];
+  short addr[2];
+  char kinds[2];
+  short old[2];
+  int n = 0, res;
+
+  if( ! m->watching ){
+    return cpu_process_switch(m);
+  }
+
+  if( m->ion && m->intr && ! m->intr_inhibit ){
+    addr[n] = 0; // The interrupt stores PC there
+    kinds[n++] = WATCH_WRITE;
+  } else if( (word & IF_MASK) <= JMP ){
+    short ea = direct_addr(m->pc, word);
+
+    if( word & I_MASK ){
+      short ptr = m->mem[ea];
+
+      addr[n] = ea;
+      kinds[n++] = WATCH_READ;
+      if( (ea & (PAGE_MASK|WORD_MASK)) >= 010 &&
+          (ea & (PAGE_MASK|WORD_MASK)) <= 017 ){
+        kinds[n - 1] |= WATCH_WRITE;
+        ptr = INC_12BIT(ptr);
+      }
+      ea = ((word & IF_MASK) < JMS ? m->df_base : m->if_base) | ptr;
+    }
+    if( access[word >> 9] ){
+      addr[n] = ea;
+      kinds[n++] = access[word >> 9];
+    }
+  }
+
+  for( int i = 0; i < n; i++ ){
+    if( WATCHED(m, addr[i]) ){
+      old[i] = m->mem[addr[i]];
+    } else {
+      kinds[i] = 0;
+    }
+  }
+  res = cpu_process_switch(m);
+  for( int i = 0; i < n; i++ ){
+    char w = kinds[i] ? m->watches[addr[i]] : 0;
+    if( (w & kinds[i] & (WATCH_READ|WATCH_WRITE)) ||
+        ((w & WATCH_CHANGE) && (kinds[i] & WATCH_WRITE) &&
+         m->mem[addr[i]] != old[i]) ){
+      m->watch_addr = addr[i];
+      m->attention |= ATTN_WATCH;
+    }
+  }
+  return res;
+}
+
+
+int cpu_process(pdp8_machine_t *m)
+{
+  if( m->watching ){
+    return process_watched(m);
+  }
+#ifdef __GNUC__
+  if( m->engine == ENGINE_THREADED ){
+    return cpu_process_threaded(m);
+  }
+#endif
+  return cpu_process_switch(m);
+}
+
+
+// Single step functions with the signature of cpu_process_block(),
+// so every engine fits the same run loop.
+static int step_switch(pdp8_machine_t *m, int *count)
+{
+  *count = 1;
+  return cpu_process_switch(m);
+}
+
+#ifdef __GNUC__
+static int step_threaded(pdp8_machine_t *m, int *count)
+{
+  *count = 1;
+  return cpu_process_threaded(m);
+}
+#else
+#define step_threaded step_switch
+#endif
+
+// Single step with the switch engine and tell the profiler about
+// calls and returns. mb and cpma are left with the executed word and
+// its effective address, an interrupt looks like a JMS to 0.
+static int step_profiled(pdp8_machine_t *m, int *count)
+{
+  short pc = m->pc;
+  int res = process_watched(m);
+
+  *count = 1;
+  m->prof.instructions++;
+  if( (m->mb & IF_MASK) == JMS ){
+    prof_call(m, m->cpma);
+  } else if( (m->mb & (IF_MASK|I_MASK)) == (JMP|I_MASK) ){
+    prof_return(m, direct_addr(pc, m->mb));
+  }
+  return res;
+}
+
+// Single step with the switch engine, recording each instruction that
+// passes the trace filter to the trace file before it executes.
+static int step_traced(pdp8_machine_t *m, int *count)
+{
+  *count = 1;
+  if( m->trace.on && trace_filter_pass(m) ){
+    trace_record(m);
+  }
+  return process_watched(m);
+}
+
+static int step_watched(pdp8_machine_t *m, int *count)
+{
+  *count = 1;
+  return process_watched(m);
+}
+
+
+// Run loops are specialized at compile time for each engine, with and
+// without the breakpoint and stop_at test. Without breakpoints the
+// only checks between instructions are m->attention and the deadline
+// of the next event. count passes the remaining budget to the step
+// function, which only the block engine uses.
+#define RUN_LOOP(name, step, stop_checks)                             \
+  static long name(pdp8_machine_t *m, long budget)                    \
+  {                                                                   \
+    long executed = 0;                                                \
+    int count;                                                        \
+    int res = 0;                                                      \
+                                                                      \
+    while( executed < budget ){                                       \
+      count = budget - executed < INT_MAX ?                           \
+        budget - executed : INT_MAX;                                  \
+      res = step(m, &count);                                          \
+      executed += count;                                              \
+      if( res || m->attention || m->time >= m->deadline ||           \
+          (stop_checks && m->breakpoints[m->pc]) ){                   \
+        break;                                                        \
+      }                                                               \
+    }                                                                 \
+                                                                      \
+    if( res == -1 ){                                                  \
+      m->attention |= ATTN_HALT;                                      \
+    }                                                                 \
+    return executed;                                                  \
+  }
+
+RUN_LOOP(run_switch, step_switch, 0)
+RUN_LOOP(run_switch_stops, step_switch, 1)
+RUN_LOOP(run_threaded, step_threaded, 0)
+RUN_LOOP(run_threaded_stops, step_threaded, 1)
+RUN_LOOP(run_block, cpu_process_block, 0)
+RUN_LOOP(run_block_stops, cpu_process_block, 1)
+RUN_LOOP(run_profiled, step_profiled, 1)
+RUN_LOOP(run_traced, step_traced, 1)
+RUN_LOOP(run_watched, step_watched, 1)
+#undef RUN_LOOP
+
+static long (* const run_loops[][2])(pdp8_machine_t *m, long budget) = {
+  [ENGINE_SWITCH] = { run_switch, run_switch_stops },
+  [ENGINE_THREADED] = { run_threaded, run_threaded_stops },
+  [ENGINE_BLOCK] = { run_block, run_block_stops },
+  [ENGINE_AOT] = { run_block, run_block_stops },
+};
+
+
+// Select the run loops that check breakpoints[] after every
+// instruction. Only needed while a breakpoint or stop_at is set.
+void cpu_set_stop_checks(pdp8_machine_t *m, char enable)
+{
+  m->stop_checks = enable != 0;
+}
+
+
+// Execute up to budget instructions, or until the next event is due.
+// Returns the number of executed instructions. A HLT sets ATTN_HALT in
+// m->attention.
+long cpu_run(pdp8_machine_t *m, long budget)
+{
+  return run_loops[m->engine][(int)m->stop_checks](m, budget);
+}
+
+
+// cpu_run() for the profiler, always with the switch engine and the
+// stop checks, see prof_run().
+long cpu_run_profiled(pdp8_machine_t *m, long budget)
+{
+  return run_profiled(m, budget);
+}
+
+
+// cpu_run() while any watch is set, with the switch engine and the
+// stop checks. Stops after an instruction that hits a watch.
+long cpu_run_watched(pdp8_machine_t *m, long budget)
+{
+  return run_watched(m, budget);
+}
+
+
+// cpu_run() while writing a trace file, see trace_run().
+long cpu_run_traced(pdp8_machine_t *m, long budget)
+{
+  return run_traced(m, budget);
+}
+
+
+// Idle loop detection. Guests wait for a TTY flag in short loops like
+// "KSF; JMP .-1", or with an ISZ timeout:
+//
+//   LOOP, KSF        / or TSF, TSK, CLSC
+//         SKP
+//         JMP READY
+//         ISZ TIMER
+//         JMP LOOP
+//
+// While the flags are clear such a loop changes nothing but its ISZ
+// counters. cpu_idle_skip() follows the loop from PC for at most
+// IDLE_MAX_LEN instructions, assuming the flags stay clear until the
+// device event at deadline, or the next clock tick in a CLSC loop. It
+// returns 0 if the machine is not in such
+// a loop and -1 if the loop has no counters and there is no deadline,
+// so only keyboard input can end it. Otherwise the counters and the
+// emulated time are advanced by as many trips around the loop as they
+// allow without running out or reaching deadline, and the number of
+// skipped instructions is returned.
+#define IDLE_MAX_LEN 8
+
+long cpu_idle_skip(pdp8_machine_t *m, unsigned long long deadline)
+{
+  short loop[IDLE_MAX_LEN];
+  short counters[IDLE_MAX_LEN];
+  int len = 0, n_counters = 0;
+  short pc = m->pc;
+  long trips = B12_MASK;
+  long loop_time = 0;
+  int i, j;
+
+  if( (m->ion && m->intr) || m->ion_delay || m->rtf_delay ||
+      m->intr_inhibit || m->uf ){
+    return 0; // The machine changes state on its own
+  }
+
+  do {
+    short word = m->mem[pc];
+    short addr;
+
+    if( len == IDLE_MAX_LEN || m->breakpoints[pc] ){
+      return 0;
+    }
+    loop[len++] = pc;
+    loop_time += cpu_instruction_time(pc, word);
+
+    if( (word & IF_MASK) <= JMP && (word & I_MASK) ){
+      return 0; // Only direct ISZ and JMP
+    }
+
+    switch( word & IF_MASK ){
+    case ISZ:
+      addr = direct_addr(pc, word);
+      if( WATCHED(m, addr) ){
+        return 0; // Every increment must be seen
+      }
+      for( i = 0; i < n_counters; i++ ){
+        if( counters[i] == addr ){
+          return 0; // Counted more than once per trip
         }
-      } else {
-        // Group Three
-        if( mb & CLA ){
-          // CLear Accumulator
-          ac = ac & LINK_MASK;
+      }
+      if( INC_12BIT(m->mem[addr]) == 0 ){
+        return 0; // Runs out on this trip
+      }
+      counters[n_counters++] = addr;
+      pc = INC_PC(pc);
+      break;
+    case JMP:
+      pc = direct_addr(pc, word);
+      break;
+    case IOT:
+      if( (word == (IOT|(03 << 3)|KSF) && ! m->tty.kb_flag) ||
+          (word == (IOT|(04 << 3)|TSF) && ! m->tty.tp_flag) ||
+          (word == (IOT|(04 << 3)|TSK) && ! m->tty.tp_flag && ! m->tty.kb_flag) ){
+        pc = INC_PC(pc);
+        break;
+      }
+      if( word == (IOT|(013 << 3)|CLSC) && ! m->clk.flag &&
+          m->time < m->clk.next_tick ){
+        if( m->clk.next_tick < deadline ){
+          deadline = m->clk.next_tick; // Ends the wait
         }
+        pc = INC_PC(pc);
+        break;
+      }
+      return 0;
+    case OPR:
+      if( word == OPR ){ // NOP
+        pc = INC_PC(pc);
+        break;
+      }
+      if( word == (OPR|OPR_G2|OPR_AND) ){ // SKP
+        pc = INC_PC(pc);
+        pc = INC_PC(pc);
+        break;
+      }
+      return 0;
+    default:
+      return 0;
+    }
+  } while( pc != m->pc );
 
-        if( (mb & MQA) && (mb & MQL) ){
-          // Swap ac and mq
-          short tmp = mq & B12_MASK;
-          mq = ac & AC_MASK;
-          ac = (ac & LINK_MASK) | tmp;
-        } else {
-          // Otherwise apply MQA or MQL separately
-          if( mb & MQA ){
-            ac = ac | (mq & B12_MASK);
-          }
+  if( n_counters == 0 && deadline == EVENT_NEVER ){
+    return -1;
+  }
+  if( deadline != EVENT_NEVER ){
+    // Stop short of the deadline, the event may end the loop in the
+    // middle of a trip.
+    if( deadline <= m->time + loop_time ){
+      return 0;
+    }
+    if( (long)((deadline - m->time - 1) / loop_time) < trips ){
+      trips = (deadline - m->time - 1) / loop_time;
+    }
+  }
 
-          if( mb & MQL ){
-            mq = ac & AC_MASK;
-            ac = ac & LINK_MASK;
-          }
-        }
+  for( i = 0; i < n_counters; i++ ){
+    for( j = 0; j < len; j++ ){
+      if( counters[i] == loop[j] ){
+        return 0; // Self modifying
       }
     }
-    break;
-  default:
-    break;
+    if( B12_MASK - m->mem[counters[i]] < trips ){
+      trips = B12_MASK - m->mem[counters[i]];
+    }
   }
-  return 0;
+  for( i = 0; i < n_counters; i++ ){
+    cpu_store_mem(m, counters[i], m->mem[counters[i]] + trips);
+  }
+  m->time += trips * loop_time;
+  return trips * len;
 }
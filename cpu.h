@@ -9,38 +9,54 @@
 #ifndef _CPU_H_
 #define _CPU_H_
 
-// TODO implement "clear" command that initializes these variables,
-// just like the clear switch on a real front panel.
-// CPU registers
-extern short pc; // Program Counter (and Instruction Field, if)
-extern short ac; // Acumulator
-extern short mq; // Multiplier Quotient
-extern short sr; // Switch Registers, 1 is switch up
-extern short ion; // Interrupt enable flipflop
-extern short ion_delay; //ion will be set after next fetch
-extern short intr; // Interrupt requested flags
-// Memory extension registers
-extern short ib; // Instruction buffer
-extern short sf; // save field
-extern short df; // data field
-extern short intr_inhibit; // interrupt inhibit flag
-// Time share registers
-extern short uf; // User Field
-extern short ub; // User Buffer
-// TODO remove rtf_delay
-extern short rtf_delay; //ion will be set after next fetch
-// TODO add F D E state bits
-
-extern short mem[];
-extern short breakpoints[];
-
-void cpu_init(void);
-int cpu_process(void);
-short direct_addr(short pc);
-short operand_addr(short pc, char examine);
-void cpu_raise_interrupt(short flag);
+// The state of one machine, defined in pdp8.h.
+typedef struct pdp8_machine pdp8_machine_t;
+
+// Execution engines, ENGINE_THREADED needs GCC computed gotos.
+// ENGINE_BLOCK and ENGINE_AOT run translated basic blocks through
+// cpu_process_block(), cpu_process() always executes one instruction
+// with the switch engine. ENGINE_AOT is only available when built
+// with -DAOT_BUILD and code generated by 8aot.
+typedef enum cpu_engine {
+  ENGINE_SWITCH,
+  ENGINE_THREADED,
+  ENGINE_BLOCK,
+  ENGINE_AOT,
+} cpu_engine_t;
+
+// cpu_run() returns as soon as any bit is set in m->attention, or
+// when it reaches an address with a breakpoint or stop_at set and
+// stop checks are enabled with cpu_set_stop_checks().
+#define ATTN_HALT 01    // HLT executed
+#define ATTN_CONSOLE 02 // Console wants the machine back
+#define ATTN_WATCH 04   // A watched word was accessed
+
+pdp8_machine_t *cpu_create(void);
+void cpu_destroy(pdp8_machine_t *m);
+char cpu_setup(pdp8_machine_t *m);
+void cpu_release(pdp8_machine_t *m);
+void cpu_init(pdp8_machine_t *m);
+char cpu_set_engine(pdp8_machine_t *m, cpu_engine_t engine);
+int cpu_process(pdp8_machine_t *m);
+long cpu_run(pdp8_machine_t *m, long budget);
+long cpu_run_profiled(pdp8_machine_t *m, long budget);
+long cpu_run_watched(pdp8_machine_t *m, long budget);
+long cpu_run_traced(pdp8_machine_t *m, long budget);
+long cpu_idle_skip(pdp8_machine_t *m, unsigned long long deadline);
+void cpu_count(pdp8_machine_t *m, short pc, short word);
+void cpu_iot(pdp8_machine_t *m);
+short cpu_instruction_time(short pc, short word);
+void cpu_set_stop_checks(pdp8_machine_t *m, char enable);
+int cpu_process_block(pdp8_machine_t *m, int *count);
+void cpu_store_mem(pdp8_machine_t *m, short addr, short val);
+void cpu_invalidate_page(pdp8_machine_t *m, short addr);
+short direct_addr(short pc, short word);
+short operand_addr(pdp8_machine_t *m, short pc, char examine);
+void cpu_raise_interrupt(pdp8_machine_t *m, short flag);
 
 #define MEMSIZE 0100000 // MAX 0100000
+#define PAGES (MEMSIZE >> 7)
+#define PAGE_OF(x) (((x) & 077777) >> 7)
 #define FIELD_MASK 070000
 #define PAGE_MASK 07600
 #define WORD_MASK 0177
@@ -59,6 +75,115 @@ void cpu_raise_interrupt(short flag);
 #define IOT_OP_MASK 07
 #define MMU_DI_MASK 070
 #define BREAKPOINT 0100000
+#define STOP_AT 040000
+
+// Conditions on breakpoints, in m->bp_conds[] and checked by
+// machine_run() when the PC reaches a breakpoint with one. All the
+// compares must hold, then the first ignore hits don't stop.
+#define BP_CONDS 16
+#define BP_COMPARES 4
+
+// bp_compare_t what
+#define BP_AC 0
+#define BP_MQ 1
+#define BP_DF 2
+#define BP_IF 3
+#define BP_MEM 4 // The word at mem
+
+// bp_compare_t op
+#define BP_EQ 0
+#define BP_NE 1
+#define BP_LT 2
+#define BP_LE 3
+#define BP_GT 4
+#define BP_GE 5
+
+typedef struct bp_compare {
+  char what;
+  char op;
+  short mem;
+  short value;
+} bp_compare_t;
+
+typedef struct bp_cond {
+  char used;
+  short addr;
+  char compares;
+  bp_compare_t compare[BP_COMPARES];
+  long ignore; // Hits left before it stops
+  long hits; // Times the compares held
+} bp_cond_t;
+
+// Watchpoints in m->watches[]. Indirect addressing reads the pointer
+// and autoindexing writes it, EAE operands are not watched.
+#define WATCH_READ 01
+#define WATCH_WRITE 02
+#define WATCH_CHANGE 04 // Writes that change the value
+
+// Whether the 128 word page of addr has any watch, one word of
+// m->watch_pages[] per field.
+#define WATCHED(m, addr) \
+  (((m)->watch_pages[(addr) >> 12] >> (((addr) >> 7) & 31)) & 1)
+
+// Instruction statistics in m->stats[], only counted when built with
+// -DCPU_STATS. Memory references are counted as one of direct,
+// indirect or autoindex, OPRs once for every microinstruction bit set
+// and IOTs by device and operation. The memory heatmap counts the
+// accesses of each kind per 128 word page, pointer words and
+// operands of MRIs but not EAE operands or data breaks.
+#define STAT_OPCODE(op) (op)
+#define STAT_DIRECT 8
+#define STAT_INDIRECT 9
+#define STAT_AUTOINDEX 10
+#define STAT_OPR(group, bit) (11 + ((group) - 1) * 8 + (bit))
+#define STAT_IOT(dev, op) (35 + (dev) * 8 + (op))
+#define STAT_HEAT(kind, page) (35 + 64 * 8 + (kind) * PAGES + (page))
+#define STAT_COUNT STAT_HEAT(HEAT_KINDS, 0)
+
+#define HEAT_FETCH 0
+#define HEAT_READ 1
+#define HEAT_WRITE 2
+#define HEAT_AUTOINDEX 3
+#define HEAT_KINDS 4
+
+// Execution coverage, one bit per address in m->coverage[] set on
+// every instruction fetch. Always on. The words are unsigned int
+// rather than bytes, a char store would make the compiler reload the
+// machine state after every instruction.
+#define COVERAGE_SET(m, pc) ((m)->coverage[(pc) >> 5] |= 1U << ((pc) & 31))
+#define COVERAGE_SIZE (MEMSIZE / 8) // Bytes in the saved bitmap
+
+// The last HISTORY_SIZE instructions with the AC, link and MQ they
+// started with, in m->history[] up to m->history_pos. Always on, a
+// few stores per instruction.
+#define HISTORY_SIZE 512
+
+typedef struct history {
+  short pc;
+  short word;
+  short ac; // With the link
+  short mq;
+} history_t;
+
+#define HISTORY_ADD(m, pc_, word_, ac_, mq_) do {                        \
+    history_t *h_ = &(m)->history[(m)->history_pos++ & (HISTORY_SIZE - 1)]; \
+    h_->pc = (pc_);                                                     \
+    h_->word = (word_);                                                 \
+    h_->ac = (ac_);                                                     \
+    h_->mq = (mq_);                                                     \
+  } while( 0 )
+
+#ifdef CPU_STATS
+#define CPU_COUNT(m, pc, word) cpu_count(m, pc, word)
+#else
+#define CPU_COUNT(m, pc, word)
+#endif
+
+// PDP-8/E timing in nanoseconds, see cpu_instruction_time()
+#define T_FAST_CYCLE 1200 // FETCH, DEFER and data breaks
+#define T_SLOW_CYCLE 1400 // EXECUTE of MRIs and IOTs
+#define T_AUTOINDEX 200   // DEFER through an autoindex register
+#define T_EAE_STEP 300    // One KE8E shift or add step, approximate
 
 #define INSTR(x) ((x)<<9)
 #define INC_12BIT(x) (((x)+1) & B12_MASK)
@@ -68,6 +193,7 @@ void cpu_raise_interrupt(short flag);
 #define TTYO_INTR_FLAG INTR(0)
 #define TTYI_INTR_FLAG INTR(1)
 #define UINTR_FLAG INTR(2)
+#define CLK_INTR_FLAG INTR(3)
 
 #define AND INSTR(0)
 #define TAD INSTR(1)
@@ -105,6 +231,13 @@ void cpu_raise_interrupt(short flag);
 #define MQA 0100
 #define MQL 0020
 
+// KE8E EAE, the rest of group three. SCA and the operation code
+// select the EAE operation, see eae() in cpu.c.
+#define SCA 0040
+#define EAE_OP_MASK 0016
+#define SWAB 07431 // Switch from mode A to mode B
+#define SWBA 07447 // Switch from mode B to mode A, only in mode B
+
 #define SKON 00
 #define ION 01
 #define IOF 02
@@ -129,6 +262,11 @@ void cpu_raise_interrupt(short flag);
 #define TSK 5
 #define TLS 6
 
+// DK8-EA OP-codes:
+#define CLEI 1
+#define CLDI 2
+#define CLSC 3
+
 // KM8E OP-codes:
 #define CDF 01
 #define CIF 02
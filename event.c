@@ -0,0 +1,126 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "event.h"
+#include "pdp8.h"
+
+static void swap(event_t *a, event_t *b)
+{
+  event_t tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+// Restore the heap order after the event at i changed time or was
+// replaced by the last one.
+static void fix(event_queue_t *q, int i)
+{
+  while( i > 0 && q->heap[i].time < q->heap[(i - 1) / 2].time ){
+    swap(&q->heap[i], &q->heap[(i - 1) / 2]);
+    i = (i - 1) / 2;
+  }
+  while( 1 ){
+    int first = i;
+    int child = 2 * i + 1;
+    if( child < q->len && q->heap[child].time < q->heap[first].time ){
+      first = child;
+    }
+    if( child + 1 < q->len && q->heap[child + 1].time < q->heap[first].time ){
+      first = child + 1;
+    }
+    if( first == i ){
+      break;
+    }
+    swap(&q->heap[i], &q->heap[first]);
+    i = first;
+  }
+}
+
+static void remove_at(pdp8_machine_t *m, int i)
+{
+  event_queue_t *q = &m->events;
+
+  q->len--;
+  if( i < q->len ){
+    q->heap[i] = q->heap[q->len];
+    fix(q, i);
+  }
+  m->deadline = q->len ? q->heap[0].time : EVENT_NEVER;
+}
+
+
+void event_reset(pdp8_machine_t *m)
+{
+  m->events.len = 0;
+  m->deadline = EVENT_NEVER;
+}
+
+
+// Run fn delay nanoseconds of emulated time from now. A pending event
+// with the same handler is moved.
+void event_post(pdp8_machine_t *m, unsigned long long delay, event_fn fn)
+{
+  event_queue_t *q = &m->events;
+  int i;
+
+  for( i = 0; i < q->len && q->heap[i].fn != fn; i++ )
+    ;
+  if( i == q->len ){
+    if( q->len == EVENT_MAX ){
+      printf("?? event queue full ??\n");
+      exit(EXIT_FAILURE);
+    }
+    q->heap[q->len++].fn = fn;
+  }
+  q->heap[i].time = m->time + delay;
+  fix(q, i);
+  m->deadline = q->heap[0].time;
+}
+
+
+void event_cancel(pdp8_machine_t *m, event_fn fn)
+{
+  for( int i = 0; i < m->events.len; i++ ){
+    if( m->events.heap[i].fn == fn ){
+      remove_at(m, i);
+      return;
+    }
+  }
+}
+
+
+// The time of the first pending event with another handler than
+// ignore, EVENT_NEVER if there is none.
+unsigned long long event_next(pdp8_machine_t *m, event_fn ignore)
+{
+  unsigned long long next = EVENT_NEVER;
+
+  for( int i = 0; i < m->events.len; i++ ){
+    if( m->events.heap[i].fn != ignore && m->events.heap[i].time < next ){
+      next = m->events.heap[i].time;
+    }
+  }
+  return next;
+}
+
+
+// Run the events that are due, in order. Returns -1 as soon as a
+// handler does, the events after it stay pending.
+char event_run(pdp8_machine_t *m)
+{
+  while( m->deadline <= m->time ){
+    event_fn fn = m->events.heap[0].fn;
+    remove_at(m, 0);
+    if( fn(m) == -1 ){
+      return -1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,41 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _EVENT_H_
+#define _EVENT_H_
+
+#include "cpu.h"
+
+// Device events, scheduled on the emulated time in m->time. An event
+// handler returns -1 to make machine_run() return to the console.
+typedef char (*event_fn)(pdp8_machine_t *m);
+
+// At most one event per handler is pending, so EVENT_MAX must be at
+// least the number of handlers.
+#define EVENT_MAX 8
+#define EVENT_NEVER (~0ULL)
+
+typedef struct event {
+  unsigned long long time;
+  event_fn fn;
+} event_t;
+
+// Min-heap on time, part of pdp8_machine_t. The time of the first
+// event is kept in m->deadline.
+typedef struct event_queue {
+  int len;
+  event_t heap[EVENT_MAX];
+} event_queue_t;
+
+void event_reset(pdp8_machine_t *m);
+void event_post(pdp8_machine_t *m, unsigned long long delay, event_fn fn);
+void event_cancel(pdp8_machine_t *m, event_fn fn);
+unsigned long long event_next(pdp8_machine_t *m, event_fn ignore);
+char event_run(pdp8_machine_t *m);
+
+#endif // _EVENT_H_
@@ -10,11 +10,10 @@
 #include "tty.h"
 #include "serial_com.h"
 #include "machine.h"
+#include "pdp8.h"
 
 char com_buf_len = 0;
 char com_buf[128];
-char trace_instruction = 0;
-short internal_stop_at = -1;
 
 #define UNUSED(x) (void)(x);
 
@@ -26,7 +25,6 @@ short internal_stop_at = -1;
 #include <stdio.h>
 #include <unistd.h>
 int ptm = -1; // PTY master handle
-int tty_skip_count = 0;
 #include <string.h>
 #endif
 
@@ -39,6 +37,7 @@ int tty_skip_count = 0;
 #define _BSD_SOURCE 1
 #define __USE_MISC 1
 #include <termios.h>
+#include <string.h>
 int pts = -1; // PTY slave handle
 #endif
 
@@ -47,23 +46,36 @@ int pts = -1; // PTY slave handle
 #include <string.h>
 #include <stdio.h>
 #include "console.h"
-int tty_skip_count = 0;
-int interrupted_by_console = 0;
 #endif
 
-void machine_setup(char *pty_name)
+#if defined(PTY_SRV) || defined(SERVER_BUILD)
+#include <limits.h>
+#include <time.h>
+#endif
+
+// Create a machine. The PTY client has no local machine, the state
+// lives in the server, so NULL is returned there.
+pdp8_machine_t *machine_setup(char *pty_name)
 {
+  pdp8_machine_t *m = NULL;
+
+#if defined(SERVER_BUILD) || defined(PTY_SRV)
+  m = cpu_create();
+  if( m == NULL ){
+    printf("Unable to allocate machine\n");
+    exit(EXIT_FAILURE);
+  }
+  tty_reset(m);
+  tty_connect(m);
+#endif
+
 #ifdef SERVER_BUILD
   UNUSED(pty_name); // To avoid warning.
-  cpu_init();
-  tty_reset();
 #endif
 
 
 #ifdef PTY_SRV
   UNUSED(pty_name); // To avoid warning.
-  cpu_init();
-  tty_reset();
 
   if( (ptm = posix_openpt(O_RDWR|O_NOCTTY)) == -1){
     printf("Unable to open PTMX\n");
@@ -105,6 +117,8 @@ void machine_setup(char *pty_name)
   cfmakeraw(&cons_new_settings);
   tcsetattr(pts, TCSANOW, &cons_new_settings);
 #endif
+
+  return m;
 }
 
 
@@ -137,45 +151,203 @@ void write_tty_byte(char output)
 }
 
 
-char machine_run(char single)
+// Block until there may be TTY input, or timeout milliseconds (-1 is
+// forever). The PTY server only gets input when it asks the client,
+// so it never blocks.
+void wait_tty_input(int timeout)
+{
+#ifdef PTY_SRV
+  UNUSED(timeout);
+#else
+  console_wait_tty_input(timeout);
+#endif
+}
+
+
+#if defined(PTY_SRV) || defined(SERVER_BUILD)
+// If the guest spins in a flag wait loop its ISZ timeouts and the
+// emulated time are skipped ahead to the next device event, and if
+// nothing but TTY input can end the wait the host sleeps until there
+// is some.
+static void machine_idle(pdp8_machine_t *m)
+{
+  long skipped = cpu_idle_skip(m, event_next(m, tty_process));
+
+  if( skipped > 0 ){
+    m->prof.instructions += skipped;
+  }
+
+  if( skipped < 0 && ! m->attention ){
+#ifndef PTY_SRV
+    wait_tty_input(-1);
+    event_post(m, 0, tty_process); // Poll again right away
+#endif
+  } else if( skipped > 0 && m->warp ){
+    m->pace_host = 0; // Run on from the skipped ahead time
+  }
+}
+
+
+#define PACE_AHEAD 10000000ULL // Sleep when the guest is 10 ms ahead
+#define PACE_BEHIND 100000000ULL // and start over when 100 ms behind
+
+static unsigned long long host_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Called after the events when running at a set speed. The emulated
+// time since pacing started, scaled by the speed, is compared to the
+// host clock and the host sleeps off any lead of more than PACE_AHEAD.
+// Both clocks count from the same start, so the error of each sleep
+// is corrected by the next one instead of adding up. A guest that
+// falls far behind, because the host was busy or slept in
+// machine_idle(), runs on from where it is rather than in a burst.
+static void machine_pace(pdp8_machine_t *m)
+{
+  unsigned long long host = host_time();
+  unsigned long long guest;
+
+  if( m->pace_host == 0 || m->time < m->pace_time ){
+    m->pace_host = host;
+    m->pace_time = m->time;
+    return;
+  }
+  guest = (m->time - m->pace_time) * 100 / m->speed;
+  host -= m->pace_host;
+  if( guest > host + PACE_AHEAD ){
+    struct timespec ts = { (guest - host) / 1000000000ULL,
+                           (guest - host) % 1000000000ULL };
+    nanosleep(&ts, NULL);
+  } else if( host > guest + PACE_BEHIND ){
+    m->pace_host = 0;
+  }
+}
+
+
+// The condition of the breakpoint at addr, NULL if it has none.
+static bp_cond_t *find_bp_cond(pdp8_machine_t *m, short addr)
+{
+  for( int i = 0; i < BP_CONDS; i++ ){
+    if( m->bp_conds[i].used && m->bp_conds[i].addr == addr ){
+      return &m->bp_conds[i];
+    }
+  }
+  return NULL;
+}
+
+// Called at a breakpoint, whether it stops. A breakpoint without a
+// condition always does. Otherwise the hit is counted when all the
+// compares hold, and it stops once the ignore count has run out. Also
+// used by the batch engine for its lanes.
+char machine_bp_cond_stop(pdp8_machine_t *m)
+{
+  bp_cond_t *c = find_bp_cond(m, m->pc);
+
+  if( c == NULL ){
+    return 1;
+  }
+  for( int i = 0; i < c->compares; i++ ){
+    bp_compare_t *cmp = &c->compare[i];
+    short val;
+    char hold = 0;
+
+    switch( cmp->what ){
+    case BP_AC: val = m->ac & AC_MASK; break;
+    case BP_MQ: val = m->mq; break;
+    case BP_DF: val = m->df; break;
+    case BP_IF: val = m->pc >> 12; break;
+    default: val = m->mem[cmp->mem]; break;
+    }
+    switch( cmp->op ){
+    case BP_EQ: hold = val == cmp->value; break;
+    case BP_NE: hold = val != cmp->value; break;
+    case BP_LT: hold = val < cmp->value; break;
+    case BP_LE: hold = val <= cmp->value; break;
+    case BP_GT: hold = val > cmp->value; break;
+    case BP_GE: hold = val >= cmp->value; break;
+    }
+    if( ! hold ){
+      return 0;
+    }
+  }
+  c->hits++;
+  if( c->ignore > 0 ){
+    c->ignore--;
+    return 0;
+  }
+  return 1;
+}
+#endif
+
+
+char machine_run(pdp8_machine_t *m, char single)
 {
 #if defined(PTY_SRV) || defined(SERVER_BUILD)
+  m->pace_host = 0; // The console may have kept us for any time
   while(1) {
 #ifdef PTY_SRV
     if( recv_console_break(ptm) ){
       return 'I';
     }
 #endif
-#ifdef SERVER_BUILD
-    if( interrupted_by_console ){
-      interrupted_by_console = 0;
+    if( m->attention & ATTN_CONSOLE ){
+      m->attention &= ~ATTN_CONSOLE;
       return 'I';
     }
-#endif
 
-    // This loops calls each emulated device in turn and any call that
-    // uses recv_cmd() must return to console mode immediately if the
-    // CONSOLE byte has been received.
+    // This loops runs the device events that are due and any event
+    // that uses recv_cmd() must return to console mode immediately if
+    // the CONSOLE byte has been received.
 
     // Any device that can should be able to resume state if CONSOLE
     // has been recv:d
 
-    if( single || tty_skip_count++ >= 100  ){ // TODO simulate slow TTY (update maindec-d0cc to do all loops)
-      tty_skip_count = 0;
-      if( tty_process() == -1 ){
-        return 'I';
+    if( event_run(m) == -1 ){
+      return 'I';
+    }
+
+    if( single || m->trace_instruction ){
+      if( m->trace.on && trace_filter_pass(m) ){
+        trace_record(m);
+      }
+      if( cpu_process(m) == -1 ){
+        m->attention |= ATTN_HALT;
+      }
+    } else {
+      machine_idle(m);
+      if( m->speed ){
+        machine_pace(m);
+      }
+      // Run up to the next event
+      if( m->trace.on ){
+        trace_run(m);
+      } else if( m->prof.on ){
+        prof_run(m);
+      } else if( m->watching ){
+        cpu_run_watched(m, LONG_MAX);
+      } else {
+        cpu_run(m, LONG_MAX);
       }
     }
-  
-    if( cpu_process() == -1 ){
+
+    if( m->attention & ATTN_HALT ){
+      m->attention &= ~ATTN_HALT;
       return 'H';
     }
 
-    if( breakpoints[pc] & BREAKPOINT ){
+    if( m->attention & ATTN_WATCH ){
+      m->attention &= ~ATTN_WATCH;
+      return 'W';
+    }
+
+    if( (m->breakpoints[m->pc] & BREAKPOINT) && machine_bp_cond_stop(m) ){
       return 'B';
     }
 
-    if( internal_stop_at >= 0 && pc == internal_stop_at ){
+    if( m->internal_stop_at >= 0 && m->pc == m->internal_stop_at ){
       return 'P';
     }      
 
@@ -183,7 +355,7 @@ char machine_run(char single)
       return 'S';
     }
 
-    if( trace_instruction ){
+    if( m->trace_instruction && trace_filter_pass(m) ){
 #ifdef PTY_SRV
       return 'D';
 #else
@@ -195,6 +367,7 @@ char machine_run(char single)
 #endif
 
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char run_buf[1] = { single ? 'S' : 'R' };
   send_cmd(pts, run_buf, 1);
 
@@ -208,6 +381,7 @@ char machine_run(char single)
     case 'B': // Breakpoint hit
     case 'S': // Single step done
     case 'P': // stop_at hit
+    case 'W': // Watchpoint hit
       return buf[0];
       break;
     case 'T': // TTY Request
@@ -240,6 +414,90 @@ short buf2short(unsigned char *b, int i)
 }
 
 
+// A trace filter in the 'D','T' frame is TRACE_FILTER_SIZE bytes: the
+// classes, wait, after, the device bits with the most significant byte
+// first, the number of ranges and TRACE_RANGES first and last pairs.
+void filter2buf(const trace_filter_t *f, unsigned char *b)
+{
+  b[0] = f->classes;
+  b[1] = f->wait;
+  b[2] = f->after >> 8;
+  b[3] = f->after & 0xFF;
+  for( int i = 0; i < 8; i++ ){
+    b[4 + i] = f->devices >> (56 - 8 * i);
+  }
+  b[12] = f->ranges;
+  for( int i = 0; i < TRACE_RANGES; i++ ){
+    b[13 + 4 * i] = f->first[i] >> 8;
+    b[14 + 4 * i] = f->first[i] & 0xFF;
+    b[15 + 4 * i] = f->last[i] >> 8;
+    b[16 + 4 * i] = f->last[i] & 0xFF;
+  }
+}
+
+
+void buf2filter(unsigned char *b, trace_filter_t *f)
+{
+  f->classes = b[0];
+  f->wait = b[1];
+  f->after = buf2short(b, 2);
+  f->devices = 0;
+  for( int i = 0; i < 8; i++ ){
+    f->devices = f->devices << 8 | b[4 + i];
+  }
+  f->ranges = b[12];
+  for( int i = 0; i < TRACE_RANGES; i++ ){
+    f->first[i] = buf2short(b, 13 + 4 * i);
+    f->last[i] = buf2short(b, 15 + 4 * i);
+  }
+}
+
+
+// A breakpoint condition is BP_COND_SIZE bytes: used, addr, the number
+// of compares, ignore and hits with the most significant byte first
+// and BP_COMPARES what, op, mem and value.
+void cond2buf(const bp_cond_t *c, unsigned char *b)
+{
+  b[0] = c->used;
+  b[1] = c->addr >> 8;
+  b[2] = c->addr & 0xFF;
+  b[3] = c->compares;
+  for( int i = 0; i < 4; i++ ){
+    b[4 + i] = c->ignore >> (24 - 8 * i);
+    b[8 + i] = c->hits >> (24 - 8 * i);
+  }
+  for( int i = 0; i < BP_COMPARES; i++ ){
+    const bp_compare_t *cmp = &c->compare[i];
+    b[12 + 6 * i] = cmp->what;
+    b[13 + 6 * i] = cmp->op;
+    b[14 + 6 * i] = cmp->mem >> 8;
+    b[15 + 6 * i] = cmp->mem & 0xFF;
+    b[16 + 6 * i] = cmp->value >> 8;
+    b[17 + 6 * i] = cmp->value & 0xFF;
+  }
+}
+
+
+void buf2cond(unsigned char *b, bp_cond_t *c)
+{
+  c->used = b[0];
+  c->addr = buf2short(b, 1);
+  c->compares = b[3] < BP_COMPARES ? b[3] : BP_COMPARES;
+  c->ignore = c->hits = 0;
+  for( int i = 0; i < 4; i++ ){
+    c->ignore = c->ignore << 8 | b[4 + i];
+    c->hits = c->hits << 8 | b[8 + i];
+  }
+  for( int i = 0; i < BP_COMPARES; i++ ){
+    bp_compare_t *cmp = &c->compare[i];
+    cmp->what = b[12 + 6 * i];
+    cmp->op = b[13 + 6 * i];
+    cmp->mem = buf2short(b, 14 + 6 * i);
+    cmp->value = buf2short(b, 16 + 6 * i);
+  }
+}
+
+
 void send_short(short val)
 {
   unsigned char buf[2] = { val >> 8, val & 0xFF };
@@ -274,11 +532,12 @@ void ack_console()
 void machine_srv()
 {
 #ifdef PTY_SRV
-  machine_setup(NULL);
+  pdp8_machine_t *m = machine_setup(NULL);
   while(1){
     // First start in CONSOLE mode
     unsigned char *buf;
-    if( recv_cmd(ptm, &buf) < 0 ) {
+    int len = recv_cmd(ptm, &buf);
+    if( len < 0 ) {
       ack_console(); // TODO BUG. no console commands expect an ack
       continue; // Received break and acked it, get next command.
     }
@@ -287,7 +546,7 @@ void machine_srv()
     case 'S': // Single step
       {
         char single = buf[0] == 'S' ? 1 : 0;
-        char state = machine_run(single);
+        char state = machine_run(m, single);
         switch( state ){
         case 'I':
           ack_console(); // Wait for ack.
@@ -304,23 +563,93 @@ void machine_srv()
         short res;
         switch(buf[1]){
         case 'R': // Register
-          res = machine_examine_reg(buf[2]);
+          res = machine_examine_reg(m, buf[2]);
           break;
         case 'M': // Memory
-          res = machine_examine_mem(buf2short(buf,2));
+          res = machine_examine_mem(m, buf2short(buf,2));
           break;
         case 'O': // Operand addr
-          res = machine_operand_addr(buf2short(buf,2), buf[4]);
+          res = machine_operand_addr(m, buf2short(buf,2), buf[4]);
           break;
         case 'D': // Direct addr
-          res = machine_direct_addr(buf2short(buf,2));
+          res = machine_direct_addr(m, buf2short(buf,2));
           break;
         case 'B': // Breakpoint
-          res = machine_examine_bp(buf2short(buf,2));
+          res = machine_examine_bp(m, buf2short(buf,2));
+          break;
+        case 'W': // Watchpoint
+          res = machine_examine_watch(m, buf2short(buf,2));
           break;
         case 'T': // Trace
-          res = machine_examine_trace();
+          res = machine_examine_trace(m);
           break;
+        case 'S': // Statistics counter, eight bytes
+          {
+            long long val = machine_examine_stat(m, buf2short(buf,2));
+            unsigned char sbuf[8];
+            for( int i = 0; i < 8; i++ ){
+              sbuf[i] = val >> (56 - 8 * i);
+            }
+            send_cmd(ptm, sbuf, 8);
+          }
+          continue;
+        case 'A': // All statistics counters, a count and up to
+                  // STATS_CHUNK counters from the given chunk
+          {
+            unsigned long long stats[STAT_COUNT];
+            unsigned char abuf[2 + STATS_CHUNK * 8];
+            int first = buf2short(buf,2) * STATS_CHUNK;
+            int n = 0;
+            if( first >= 0 && first < STAT_COUNT &&
+                machine_examine_stats(m, stats) ){
+              n = STAT_COUNT - first < STATS_CHUNK ?
+                STAT_COUNT - first : STATS_CHUNK;
+            }
+            abuf[0] = n >> 8;
+            abuf[1] = n & 0xFF;
+            for( int i = 0; i < n; i++ ){
+              for( int j = 0; j < 8; j++ ){
+                abuf[2 + i * 8 + j] = stats[first + i] >> (56 - 8 * j);
+              }
+            }
+            send_cmd(ptm, abuf, 2 + n * 8);
+          }
+          continue;
+        case 'H': // History, a count and the entries in one frame
+          {
+            history_t history[HISTORY_SIZE];
+            unsigned char hbuf[2 + HISTORY_SIZE * 8];
+            int n = machine_examine_history(m, history);
+            hbuf[0] = n >> 8;
+            hbuf[1] = n & 0xFF;
+            for( int i = 0; i < n; i++ ){
+              short val[4] = { history[i].pc, history[i].word,
+                               history[i].ac, history[i].mq };
+              for( int j = 0; j < 4; j++ ){
+                hbuf[2 + i * 8 + j * 2] = val[j] >> 8;
+                hbuf[3 + i * 8 + j * 2] = val[j] & 0xFF;
+              }
+            }
+            send_cmd(ptm, hbuf, 2 + n * 8);
+          }
+          continue;
+        case 'C': // Breakpoint condition, unused if there is none
+          {
+            bp_cond_t cond;
+            unsigned char cbuf[BP_COND_SIZE];
+            memset(&cond, 0, sizeof(bp_cond_t));
+            machine_examine_bp_cond(m, buf2short(buf,2), &cond);
+            cond2buf(&cond, cbuf);
+            send_cmd(ptm, cbuf, BP_COND_SIZE);
+          }
+          continue;
+        case 'V': // Coverage, the whole bitmap in one frame
+          {
+            unsigned char bitmap[COVERAGE_SIZE];
+            machine_examine_coverage(m, bitmap);
+            send_cmd(ptm, bitmap, COVERAGE_SIZE);
+          }
+          continue;
         }
         send_short(res);
       }
@@ -328,23 +657,65 @@ void machine_srv()
     case 'D': // Deposit
       switch(buf[1]){
       case 'R': // Register
-        machine_deposit_reg(buf[2], buf2short(buf,3));
+        machine_deposit_reg(m, buf[2], buf2short(buf,3));
         break;
       case 'M': // Memory
-        machine_deposit_mem(buf2short(buf,2), buf2short(buf,4));
+        machine_deposit_mem(m, buf2short(buf,2), buf2short(buf,4));
+        break;
+      case 'B': // Breakpoint, with a condition if there is more
+        if( len > 4 ){
+          bp_cond_t cond;
+          buf2cond(buf + 4, &cond);
+          send_short(machine_set_bp_cond(m, buf2short(buf, 2), &cond));
+        } else {
+          machine_toggle_bp(m, buf2short(buf, 2));
+        }
         break;
-      case 'B': // Breakpoint
-        machine_toggle_bp(buf2short(buf, 2));
+      case 'W': // Watchpoint, address -1 clears all
+        if( buf2short(buf, 2) < 0 ){
+          machine_clear_all_watches(m);
+        } else {
+          machine_set_watch(m, buf2short(buf, 2), buf[4]);
+        }
         break;
-      case 'T': // Trace
-        machine_toggle_trace();
+      case 'T': // Trace, with a filter if there is more
+        if( len > 2 ){
+          trace_filter_t filter;
+          buf2filter(buf + 2, &filter);
+          machine_toggle_trace(m, &filter);
+        } else {
+          machine_toggle_trace(m, NULL);
+        }
         break;
       case 'P': // Stop at
-        machine_set_stop_at(buf2short(buf,2));
+        machine_set_stop_at(m, buf2short(buf,2));
+        break;
+      case 'N': // Engine
+        machine_set_engine(m, buf[2]);
+        break;
+      case 'S': // Speed
+        machine_set_speed(m, buf2short(buf,2));
+        break;
+      case 'C': // Clock
+        machine_set_clock(m, buf[2], buf[3]);
+        break;
+      case 'Z': // Zero statistics
+        machine_clear_stats(m);
+        break;
+      case 'V': // Coverage
+        machine_clear_coverage(m);
+        break;
+      case 'F': // Profile
+        machine_set_profile(m, (long)buf2short(buf,3) << 16 |
+                            (unsigned short)buf2short(buf,5), buf[2]);
+        break;
+      case 'L': // Trace file, the name ends with a NUL byte
+        send_short(machine_set_trace_file(m, (char *)buf + 2));
         break;
       }
       break;
     case 'Q':
+      machine_quit(m);
       close(ptm);
       exit(EXIT_SUCCESS);
     default:
@@ -357,62 +728,67 @@ void machine_srv()
 }
 
 
-short machine_examine_mem(short addr)
+short machine_examine_mem(pdp8_machine_t *m, short addr)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[4] = { 'E', 'M', addr >> 8, addr & 0xFF };
   send_cmd(pts, buf, 4);
   unsigned char *rbuf;
   recv_cmd(pts, &rbuf);
   return buf2short(rbuf, 0);
 #else
-  return mem[addr];
+  return m->mem[addr];
 #endif
 }
 
 
-void machine_deposit_mem(short addr, short val)
+void machine_deposit_mem(pdp8_machine_t *m, short addr, short val)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[6] = { 'D', 'M', addr >> 8, addr & 0xFF, val >> 8, val & 0xFF };
   send_cmd(pts, buf, 6);
 #else
-  mem[addr] = val;
+  cpu_store_mem(m, addr, val);
 #endif
 }
 
 
-short machine_operand_addr(short addr, char examine)
+short machine_operand_addr(pdp8_machine_t *m, short addr, char examine)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[5] = { 'E', 'O', addr >> 8, addr & 0xFF, examine };
   send_cmd(pts, buf, 5);
   unsigned char *rbuf;
   recv_cmd(pts, &rbuf);
   return buf2short(rbuf, 0);
 #else
-  return operand_addr(addr, examine);
+  return operand_addr(m, addr, examine);
 #endif
 }
 
 
-short machine_direct_addr(short addr)
+short machine_direct_addr(pdp8_machine_t *m, short addr)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[4] = { 'E', 'D', addr >> 8, addr & 0xFF };
   send_cmd(pts, buf, 4);
   unsigned char *rbuf;
   recv_cmd(pts, &rbuf);
   return buf2short(rbuf, 0);
 #else
-  return direct_addr(addr);
+  return direct_addr(addr, m->mem[addr]);
 #endif
 }
 
 
-short machine_examine_deposit_reg(register_name_t reg, short val, char dep)
+short machine_examine_deposit_reg(pdp8_machine_t *m, register_name_t reg, short val, char dep)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   if( dep ){
     unsigned char buf[5] = { 'D', 'R', reg, val >> 8, val & 0xFF };
     send_cmd(pts,buf,5);
@@ -432,117 +808,156 @@ short machine_examine_deposit_reg(register_name_t reg, short val, char dep)
   switch( reg ){
   case AC:
     if( dep ){
-      ac = val;
+      m->ac = val;
     }
-    res = ac;
+    res = m->ac;
     break;
   case PC:
     if( dep ){
-      pc = val;
+      m->pc = val;
+      m->if_base = val & FIELD_MASK;
     }
-    res = pc;
+    res = m->pc;
     break;
   case MQ:
     if( dep ){
-      mq = val;
+      m->mq = val;
     }
-    res = mq;
+    res = m->mq;
     break;
   case DF:
     if( dep ){
-      df = val;
+      m->df = val;
+      m->df_base = val << 12;
     }
-    res = df;
+    res = m->df;
     break;
   case IB:
     if( dep ){
-      ib = val;
+      m->ib = val;
     }
-    res = ib;
+    res = m->ib;
     break;
   case UB:
     if( dep ){
-      ub = val;
+      m->ub = val;
     }
-    res = ub;
+    res = m->ub;
     break;
   case UF:
     if( dep ){
-      uf = val;
+      m->uf = val;
     }
-    res = uf;
+    res = m->uf;
     break;
   case SF:
     if( dep ){
-      sf = val;
+      m->sf = val;
     }
-    res = sf;
+    res = m->sf;
     break;
   case SR:
     if( dep ){
-      sr = val;
+      m->sr = val;
     }
-    res = sr;
+    res = m->sr;
     break;
   case ION_FLAG:
     if( dep ){
-      ion = val;
+      m->ion = val;
     }
-    res = ion;
+    res = m->ion;
     break;
   case ION_DELAY:
     if( dep ){
-      ion_delay = val;
+      m->ion_delay = val;
     }
-    res = ion_delay;
+    res = m->ion_delay;
     break;
   case INTR_INHIBIT:
     if( dep ){
-      intr_inhibit = val;
+      m->intr_inhibit = val;
     }
-    res = intr_inhibit;
+    res = m->intr_inhibit;
     break;
   case INTR:
     if( dep ){
-      intr = val;
+      m->intr = val;
     }
-    res = intr;
+    res = m->intr;
     break;
   case RTF_DELAY:
     if( dep ){
-      rtf_delay = val;
+      m->rtf_delay = val;
+    }
+    res = m->rtf_delay;
+    break;
+  case SC:
+    if( dep ){
+      m->sc = val;
+    }
+    res = m->sc;
+    break;
+  case GT:
+    if( dep ){
+      m->gt = val;
+    }
+    res = m->gt;
+    break;
+  case EAE_MODE:
+    if( dep ){
+      m->eae_b = val;
+    }
+    res = m->eae_b;
+    break;
+  case TIME_0:
+  case TIME_1:
+  case TIME_2:
+  case TIME_3:
+    {
+      int shift = (reg - TIME_0) * 16;
+      if( dep ){
+        m->time &= ~(0xFFFFULL << shift);
+        m->time |= (unsigned long long)(val & 0xFFFF) << shift;
+      }
+      res = (m->time >> shift) & 0xFFFF;
     }
-    res = rtf_delay;
     break;
   case TTY_KB_BUF:
     if( dep ){
-      tty_kb_buf = val;
+      m->tty.kb_buf = val;
     }
-    res = tty_kb_buf;
+    res = m->tty.kb_buf;
     break;
   case TTY_KB_FLAG:
     if( dep ){
-      tty_kb_flag = val;
+      m->tty.kb_flag = val;
     }
-    res = tty_kb_flag;
+    res = m->tty.kb_flag;
     break;
   case TTY_TP_BUF:
     if( dep ){
-      tty_tp_buf = val;
+      m->tty.tp_buf = val;
     }
-    res = tty_tp_buf;
+    res = m->tty.tp_buf;
     break;
   case TTY_TP_FLAG:
     if( dep ){
-      tty_tp_flag = val;
+      m->tty.tp_flag = val;
     }
-    res = tty_tp_flag;
+    res = m->tty.tp_flag;
     break;
   case TTY_DCR:
     if( dep ){
-      tty_dcr = val;
+      m->tty.dcr = val;
+    }
+    res = m->tty.dcr;
+    break;
+  case WATCH_ADDR:
+    if( dep ){
+      m->watch_addr = val;
     }
-    res = tty_dcr;
+    res = m->watch_addr;
     break;
 #ifdef SERVER_BUILD
   default:
@@ -556,26 +971,48 @@ short machine_examine_deposit_reg(register_name_t reg, short val, char dep)
 }
 
 
-short machine_examine_reg(register_name_t regname)
+short machine_examine_reg(pdp8_machine_t *m, register_name_t regname)
 {
-  return machine_examine_deposit_reg(regname, 0, 0);
+  return machine_examine_deposit_reg(m, regname, 0, 0);
 }
 
 
-void machine_deposit_reg(register_name_t regname, short val)
+void machine_deposit_reg(pdp8_machine_t *m, register_name_t regname, short val)
 {
-  machine_examine_deposit_reg(regname, val, 1);
+  machine_examine_deposit_reg(m, regname, val, 1);
 }
 
 
-void machine_clear_all_bp()
+#if defined(PTY_SRV) || defined(SERVER_BUILD)
+// Let cpu_run(m) skip the breakpoint test unless a breakpoint or
+// stop_at is set.
+static void update_stop_checks(pdp8_machine_t *m)
+{
+  char active = 0;
+  for( int i = 0; i < MEMSIZE && ! active; i++ ){
+    active = m->breakpoints[i] != 0;
+  }
+  cpu_set_stop_checks(m, active);
+}
+#endif
+
+
+void machine_clear_all_bp(pdp8_machine_t *m)
 {
+  UNUSED(m);
 #ifdef PTY_BUILD
   // TODO Clear all breakpoints
 #endif
 
 #ifdef SERVER_BUILD
-  memset(breakpoints, 0, MEMSIZE);
+  for( int i = 0; i < MEMSIZE; i++ ){
+    if( m->breakpoints[i] & BREAKPOINT ){
+      m->breakpoints[i] &= ~BREAKPOINT;
+      cpu_invalidate_page(m, i);
+    }
+  }
+  memset(m->bp_conds, 0, sizeof(m->bp_conds));
+  update_stop_checks(m);
 #endif
 
 #ifdef SERIAL_BUILD
@@ -583,91 +1020,495 @@ void machine_clear_all_bp()
 }
 
 
-short machine_examine_bp(short addr)
+short machine_examine_bp(pdp8_machine_t *m, short addr)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[4] = { 'E', 'B', addr >> 8, addr & 0xFF };
   send_cmd(pts, buf, 4);
   unsigned char *rbuf;
   recv_cmd(pts, &rbuf);
   return buf2short(rbuf, 0);
 #else
-  return breakpoints[addr];
+  return m->breakpoints[addr] & BREAKPOINT;
 #endif
 }
 
 
-void machine_toggle_bp(short addr)
+void machine_toggle_bp(pdp8_machine_t *m, short addr)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[4] = { 'D', 'B', addr >> 8, addr & 0xFF };
   send_cmd(pts, buf, 4);
 #else
-  breakpoints[addr] = breakpoints[addr] ^ BREAKPOINT;
+  m->breakpoints[addr] = m->breakpoints[addr] ^ BREAKPOINT;
+  if( ! (m->breakpoints[addr] & BREAKPOINT) && find_bp_cond(m, addr) ){
+    find_bp_cond(m, addr)->used = 0;
+  }
+  cpu_invalidate_page(m, addr);
+  update_stop_checks(m);
 #endif
 }
 
 
-short machine_examine_trace()
+// Set a breakpoint at addr that only stops when cond holds, see
+// machine_bp_cond_stop(). Replaces any earlier condition and restarts
+// its hit count. Returns 0 if all BP_CONDS conditions are in use.
+char machine_set_bp_cond(pdp8_machine_t *m, short addr, const bp_cond_t *cond)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4 + BP_COND_SIZE] = { 'D', 'B', addr >> 8, addr & 0xFF };
+  cond2buf(cond, buf + 4);
+  send_cmd(pts, buf, sizeof(buf));
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  return buf2short(rbuf, 0);
+#else
+  bp_cond_t *c = find_bp_cond(m, addr);
+
+  for( int i = 0; i < BP_CONDS && c == NULL; i++ ){
+    if( ! m->bp_conds[i].used ){
+      c = &m->bp_conds[i];
+    }
+  }
+  if( c == NULL ){
+    return 0;
+  }
+  *c = *cond;
+  c->used = 1;
+  c->addr = addr;
+  c->hits = 0;
+  m->breakpoints[addr] |= BREAKPOINT;
+  cpu_invalidate_page(m, addr);
+  update_stop_checks(m);
+  return 1;
+#endif
+}
+
+
+// Copy the condition of the breakpoint at addr to cond. Returns 0 if
+// it has none.
+char machine_examine_bp_cond(pdp8_machine_t *m, short addr, bp_cond_t *cond)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4] = { 'E', 'C', addr >> 8, addr & 0xFF };
+  send_cmd(pts, buf, 4);
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  buf2cond(rbuf, cond);
+  return cond->used;
+#else
+  bp_cond_t *c = find_bp_cond(m, addr);
+
+  if( c == NULL ){
+    return 0;
+  }
+  *cond = *c;
+  return 1;
+#endif
+}
+
+
+char machine_examine_watch(pdp8_machine_t *m, short addr)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4] = { 'E', 'W', addr >> 8, addr & 0xFF };
+  send_cmd(pts, buf, 4);
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  return buf2short(rbuf, 0);
+#else
+  return m->watches[addr];
+#endif
+}
+
+
+#if defined(PTY_SRV) || defined(SERVER_BUILD)
+// Recompute the page bit of addr in m->watch_pages and whether
+// machine_run() needs cpu_run_watched() at all.
+static void update_watch_page(pdp8_machine_t *m, short addr)
+{
+  short page = addr & ~WORD_MASK;
+  char any = 0;
+
+  for( int i = page; i <= (page | WORD_MASK) && ! any; i++ ){
+    any = m->watches[i] != 0;
+  }
+  if( any ){
+    m->watch_pages[addr >> 12] |= 1U << ((addr >> 7) & 31);
+  } else {
+    m->watch_pages[addr >> 12] &= ~(1U << ((addr >> 7) & 31));
+  }
+  m->watching = 0;
+  for( int i = 0; i < MEMSIZE / 4096; i++ ){
+    m->watching |= m->watch_pages[i] != 0;
+  }
+}
+#endif
+
+
+// Watch addr for the WATCH_* kinds of access, 0 removes the watch.
+void machine_set_watch(pdp8_machine_t *m, short addr, char kinds)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[5] = { 'D', 'W', addr >> 8, addr & 0xFF, kinds };
+  send_cmd(pts, buf, 5);
+#else
+  m->watches[addr] = kinds & (WATCH_READ|WATCH_WRITE|WATCH_CHANGE);
+  update_watch_page(m, addr);
+#endif
+}
+
+
+void machine_clear_all_watches(pdp8_machine_t *m)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[5] = { 'D', 'W', 0xFF, 0xFF, 0 };
+  send_cmd(pts, buf, 5);
+#else
+  memset(m->watches, 0, sizeof(m->watches));
+  memset(m->watch_pages, 0, sizeof(m->watch_pages));
+  m->watching = 0;
+#endif
+}
+
+
+short machine_examine_trace(pdp8_machine_t *m)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[2] = { 'E', 'T' };
   send_cmd(pts, buf, 2);
   unsigned char *rbuf;
   recv_cmd(pts, &rbuf);
   return rbuf[1]; // Result sent as a short, least significant byte contains boolean.
 #else
-  return trace_instruction;
+  return m->trace_instruction;
 #endif
 }
 
 
-void machine_toggle_trace()
+// Without a filter, turn the printed trace on or off. With a filter,
+// replace the filter of the printed trace and trace files instead, it
+// is evaluated before anything leaves the server.
+void machine_toggle_trace(pdp8_machine_t *m, const trace_filter_t *filter)
 {
 #ifdef PTY_CLI
-  unsigned char buf[2] = { 'D', 'T' };
-  send_cmd(pts, buf, 2);
+  UNUSED(m);
+  unsigned char buf[2 + TRACE_FILTER_SIZE] = { 'D', 'T' };
+  if( filter != NULL ){
+    filter2buf(filter, buf + 2);
+  }
+  send_cmd(pts, buf, filter != NULL ? sizeof(buf) : 2);
 #else
-  trace_instruction = !trace_instruction;
+  if( filter != NULL ){
+    trace_set_filter(m, filter);
+  } else {
+    m->trace_instruction = !m->trace_instruction;
+  }
 #endif
 }
 
 
-void machine_set_stop_at(short addr)
+void machine_set_stop_at(pdp8_machine_t *m, short addr)
 {
 #ifdef PTY_CLI
+  UNUSED(m);
   unsigned char buf[4] = { 'D', 'P', addr >> 8, addr & 0xFF };
   send_cmd(pts, buf, 4);
 #else
-  internal_stop_at = addr;
+  if( m->internal_stop_at >= 0 ){
+    m->breakpoints[m->internal_stop_at] &= ~STOP_AT;
+    cpu_invalidate_page(m, m->internal_stop_at);
+  }
+  m->internal_stop_at = addr;
+  if( m->internal_stop_at >= 0 ){
+    m->breakpoints[m->internal_stop_at] |= STOP_AT;
+    cpu_invalidate_page(m, m->internal_stop_at);
+  }
+  update_stop_checks(m);
+#endif
+}
+
+
+void machine_set_engine(pdp8_machine_t *m, char engine)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[3] = { 'D', 'N', engine };
+  send_cmd(pts, buf, 3);
+#else
+  if( ! cpu_set_engine(m, engine) ){
+    printf("?? engine not available in this build ??\n");
+  }
+#endif
+}
+
+
+// Run at speed percent of a PDP-8/E, or as fast as possible if speed
+// is 0.
+void machine_set_speed(pdp8_machine_t *m, short speed)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4] = { 'D', 'S', speed >> 8, speed & 0xFF };
+  send_cmd(pts, buf, 4);
+#else
+  m->speed = speed;
+  m->pace_host = 0;
+#endif
+}
+
+
+// Set the line frequency of the DK8-EA clock. With warp set the time
+// skipped while the guest idles, e.g. waiting for the next clock tick,
+// is not paced by --speed.
+void machine_set_clock(pdp8_machine_t *m, short hz, char warp)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4] = { 'D', 'C', hz, warp };
+  send_cmd(pts, buf, 4);
+#else
+  clk_set_frequency(m, hz);
+  m->warp = warp;
+#endif
+}
+
+
+// The statistics counter index, see STAT_COUNT in cpu.h. Returns -1
+// if index is out of range or the emulator is built without
+// CPU_STATS.
+long long machine_examine_stat(pdp8_machine_t *m, short index)
+{
+  if( index < 0 || index >= STAT_COUNT ){
+    return -1;
+  }
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[4] = { 'E', 'S', index >> 8, index & 0xFF };
+  send_cmd(pts, buf, 4);
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  long long val = 0;
+  for( int i = 0; i < 8; i++ ){
+    val = val << 8 | rbuf[i];
+  }
+  return val;
+#elif defined(CPU_STATS)
+  return m->stats[index];
+#else
+  UNUSED(m);
+  UNUSED(index);
+  return -1;
+#endif
+}
+
+
+// Copy all STAT_COUNT statistics counters. Returns 0 if the emulator
+// is built without CPU_STATS. The PTY client reads them STATS_CHUNK
+// counters at a time to fit in a frame.
+char machine_examine_stats(pdp8_machine_t *m, unsigned long long *stats)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  for( int chunk = 0; chunk * STATS_CHUNK < STAT_COUNT; chunk++ ){
+    unsigned char buf[4] = { 'E', 'A', chunk >> 8, chunk & 0xFF };
+    send_cmd(pts, buf, 4);
+    unsigned char *rbuf;
+    recv_cmd(pts, &rbuf);
+    int n = buf2short(rbuf, 0);
+    if( n == 0 ){
+      return 0;
+    }
+    for( int i = 0; i < n; i++ ){
+      unsigned long long val = 0;
+      for( int j = 0; j < 8; j++ ){
+        val = val << 8 | rbuf[2 + i * 8 + j];
+      }
+      stats[chunk * STATS_CHUNK + i] = val;
+    }
+  }
+  return 1;
+#elif defined(CPU_STATS)
+  memcpy(stats, m->stats, sizeof(m->stats));
+  return 1;
+#else
+  UNUSED(m);
+  UNUSED(stats);
+  return 0;
+#endif
+}
+
+
+void machine_clear_stats(pdp8_machine_t *m)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[2] = { 'D', 'Z' };
+  send_cmd(pts, buf, 2);
+#elif defined(CPU_STATS)
+  memset(m->stats, 0, sizeof(m->stats));
+#else
+  UNUSED(m);
+#endif
+}
+
+
+// Sample the guest PC and JMS call stack every period instructions,
+// or microseconds of emulated time with PROF_PER_TIME, and count calls
+// per routine with PROF_CALLS. machine_quit() writes the samples to
+// PROFILE_FILE and the calls to CALLGRAPH_FILE. A period of 0 without
+// PROF_CALLS stops.
+void machine_set_profile(pdp8_machine_t *m, long period, char flags)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[7] = { 'D', 'F', flags, period >> 24, period >> 16,
+                           period >> 8, period & 0xFF };
+  send_cmd(pts, buf, 7);
+#else
+  if( period > 0 || (flags & PROF_CALLS) ){
+    prof_start(m, period, flags);
+  } else {
+    prof_stop(m);
+  }
 #endif
 }
 
 
-void machine_quit()
+// Write a binary trace of every instruction executed from now on to
+// filename, see trace.h. An empty filename stops tracing and closes
+// the file. Returns 0 if the file could not be created.
+char machine_set_trace_file(pdp8_machine_t *m, const char *filename)
 {
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[FRAME_MAX];
+  int len = strlen(filename);
+  unsigned char *rbuf;
+
+  if( len > FRAME_MAX - 3 ){
+    printf("?? trace file name too long ??\n");
+    return 0;
+  }
+  buf[0] = 'D';
+  buf[1] = 'L';
+  memcpy(buf + 2, filename, len + 1);
+  send_cmd(pts, buf, len + 3);
+  recv_cmd(pts, &rbuf);
+  return buf2short(rbuf, 0);
+#else
+  if( *filename == '\0' ){
+    trace_stop(m);
+    return 1;
+  }
+  return trace_start(m, filename);
+#endif
+}
+
+
+// Copy the COVERAGE_SIZE byte bitmap of executed addresses, see
+// COVERAGE_SET(). The PTY client gets it in one frame.
+void machine_examine_coverage(pdp8_machine_t *m, unsigned char *bitmap)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[2] = { 'E', 'V' };
+  send_cmd(pts, buf, 2);
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  memcpy(bitmap, rbuf, COVERAGE_SIZE);
+#else
+  for( int i = 0; i < COVERAGE_SIZE; i++ ){
+    bitmap[i] = m->coverage[i / 4] >> (i % 4 * 8);
+  }
+#endif
+}
+
+
+// Copy the executed instructions in the history, oldest first, see
+// HISTORY_ADD(). Returns how many, at most HISTORY_SIZE. The PTY
+// client gets them all in one frame.
+int machine_examine_history(pdp8_machine_t *m, history_t *history)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[2] = { 'E', 'H' };
+  send_cmd(pts, buf, 2);
+  unsigned char *rbuf;
+  recv_cmd(pts, &rbuf);
+  int n = buf2short(rbuf, 0);
+  for( int i = 0; i < n; i++ ){
+    history[i].pc = buf2short(rbuf, 2 + i * 8);
+    history[i].word = buf2short(rbuf, 4 + i * 8);
+    history[i].ac = buf2short(rbuf, 6 + i * 8);
+    history[i].mq = buf2short(rbuf, 8 + i * 8);
+  }
+  return n;
+#else
+  int n = m->history_pos < HISTORY_SIZE ? m->history_pos : HISTORY_SIZE;
+  for( int i = 0; i < n; i++ ){
+    history[i] = m->history[(m->history_pos - n + i) & (HISTORY_SIZE - 1)];
+  }
+  return n;
+#endif
+}
+
+
+void machine_clear_coverage(pdp8_machine_t *m)
+{
+#ifdef PTY_CLI
+  UNUSED(m);
+  unsigned char buf[2] = { 'D', 'V' };
+  send_cmd(pts, buf, 2);
+#else
+  memset(m->coverage, 0, sizeof(m->coverage));
+#endif
+}
+
+
+void machine_quit(pdp8_machine_t *m)
+{
+  UNUSED(m);
 #ifdef PTY_CLI
   unsigned char buf[1] = { 'Q' };
   send_cmd(pts, buf, 1);
+#else
+  if( m->prof.samples ){
+    prof_write(m, PROFILE_FILE);
+  }
+  if( m->prof.routines ){
+    prof_write_calls(m, CALLGRAPH_FILE);
+  }
+  trace_stop(m);
 #endif
 }
 
 
-void machine_interrupt()
+void machine_interrupt(pdp8_machine_t *m)
 {
+  UNUSED(m);
 #ifdef PTY_CLI
   send_console_break(pts);
   send_console_break(pts);
 #endif
 
 #ifdef SERVER_BUILD
-  interrupted_by_console = 1;
+  m->attention |= ATTN_CONSOLE;
 #endif
 }
 
 
-void machine_halt()
+void machine_halt(pdp8_machine_t *m)
 {
+  UNUSED(m);
 #ifdef PTY_CLI
   send_console_break(pts);
   send_console_break(pts);
@@ -9,6 +9,24 @@
 #ifndef _MACHINE_H_
 #define _MACHINE_H_
 
+#include "cpu.h"
+#include "trace.h"
+
+// Written by machine_quit() when the profiler is on. The samples are
+// in the folded stack format of flamegraph tools.
+#define PROFILE_FILE "profile.folded"
+#define CALLGRAPH_FILE "callgraph.txt"
+
+// Statistics counters per 'E','A' frame
+#define STATS_CHUNK 512
+
+// Bytes of a trace filter in a 'D','T' frame, see filter2buf()
+#define TRACE_FILTER_SIZE (13 + 4 * TRACE_RANGES)
+
+// Bytes of a breakpoint condition in 'D','B' and 'E','C' frames, see
+// cond2buf()
+#define BP_COND_SIZE (12 + 6 * BP_COMPARES)
+
 typedef enum register_name {
   AC,
   PC,
@@ -24,34 +42,60 @@ typedef enum register_name {
   INTR_INHIBIT,
   INTR,
   RTF_DELAY,
+  SC,
+  GT,
+  EAE_MODE,
+  TIME_0, // Emulated time in nanoseconds, 16 bits per register with
+  TIME_1, // the least significant bits in TIME_0
+  TIME_2,
+  TIME_3,
   TTY_KB_BUF,
   TTY_KB_FLAG,
   TTY_TP_BUF,
   TTY_TP_FLAG,
   TTY_DCR,
+  WATCH_ADDR, // Address of the last watch hit
 } register_name_t;
 
-short machine_examine_mem(short addr);
-void machine_deposit_mem(short addr, short val);
-short machine_operand_addr(short addr, char examine);
-short machine_direct_addr(short addr);
-short machine_examine_reg(register_name_t regname);
-void machine_deposit_reg(register_name_t regname, short val);
-void machine_clear_all_bp(void);
-short machine_examine_bp(short addr);
-void machine_toggle_bp(short addr);
-short machine_examine_trace();
-void machine_toggle_trace();
-void machine_set_stop_at(short addr);
-void machine_interrupt();
-void machine_quit();
+short machine_examine_mem(pdp8_machine_t *m, short addr);
+void machine_deposit_mem(pdp8_machine_t *m, short addr, short val);
+short machine_operand_addr(pdp8_machine_t *m, short addr, char examine);
+short machine_direct_addr(pdp8_machine_t *m, short addr);
+short machine_examine_reg(pdp8_machine_t *m, register_name_t regname);
+void machine_deposit_reg(pdp8_machine_t *m, register_name_t regname, short val);
+void machine_clear_all_bp(pdp8_machine_t *m);
+short machine_examine_bp(pdp8_machine_t *m, short addr);
+void machine_toggle_bp(pdp8_machine_t *m, short addr);
+char machine_set_bp_cond(pdp8_machine_t *m, short addr, const bp_cond_t *cond);
+char machine_examine_bp_cond(pdp8_machine_t *m, short addr, bp_cond_t *cond);
+char machine_bp_cond_stop(pdp8_machine_t *m);
+char machine_examine_watch(pdp8_machine_t *m, short addr);
+void machine_set_watch(pdp8_machine_t *m, short addr, char kinds);
+void machine_clear_all_watches(pdp8_machine_t *m);
+short machine_examine_trace(pdp8_machine_t *m);
+void machine_toggle_trace(pdp8_machine_t *m, const trace_filter_t *filter);
+void machine_set_stop_at(pdp8_machine_t *m, short addr);
+void machine_set_engine(pdp8_machine_t *m, char engine);
+void machine_set_speed(pdp8_machine_t *m, short speed);
+void machine_set_clock(pdp8_machine_t *m, short hz, char warp);
+long long machine_examine_stat(pdp8_machine_t *m, short index);
+char machine_examine_stats(pdp8_machine_t *m, unsigned long long *stats);
+void machine_clear_stats(pdp8_machine_t *m);
+void machine_set_profile(pdp8_machine_t *m, long period, char flags);
+char machine_set_trace_file(pdp8_machine_t *m, const char *filename);
+void machine_examine_coverage(pdp8_machine_t *m, unsigned char *bitmap);
+void machine_clear_coverage(pdp8_machine_t *m);
+int machine_examine_history(pdp8_machine_t *m, history_t *history);
+void machine_interrupt(pdp8_machine_t *m);
+void machine_quit(pdp8_machine_t *m);
 void machine_srv();
 
 char read_tty_byte(char *output);
 void write_tty_byte(char output);
+void wait_tty_input(int timeout);
 
-void machine_setup(char *pty_name);
-char machine_run(char single);
-void machine_halt();
+pdp8_machine_t *machine_setup(char *pty_name);
+char machine_run(pdp8_machine_t *m, char single);
+void machine_halt(pdp8_machine_t *m);
 
 #endif // _MACHINE_H_
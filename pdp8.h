@@ -0,0 +1,97 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _PDP8_H_
+#define _PDP8_H_
+
+#include "cpu.h"
+#include "tty.h"
+#include "event.h"
+#include "clock.h"
+#include "prof.h"
+#include "trace.h"
+
+#ifdef __GNUC__
+#define CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define CACHE_ALIGNED
+#endif
+
+// All state of one emulated PDP-8. Any number of machines can live in
+// one process, each created with cpu_create(). The registers used on
+// every instruction come first and fit in one cache line.
+struct pdp8_machine {
+  // TODO implement "clear" command that initializes these variables,
+  // just like the clear switch on a real front panel.
+  // CPU registers
+  short pc; // Program Counter (and Instruction Field, if)
+  short ac; // Acumulator
+  short mq; // Multiplier Quotient
+  short mb; // Memory Buffer
+  short cpma; // Central Processor Memory Address
+  short df; // data field
+  // The fields as base addresses into mem[], so addressing never
+  // shifts or masks them. if_base is always pc & FIELD_MASK.
+  short if_base;
+  short df_base; // df << 12
+  short intr; // Interrupt requested flags
+  short ion; // Interrupt enable flipflop
+  short ion_delay; //ion will be set after next fetch
+  // TODO remove rtf_delay
+  short rtf_delay; //ion will be set after next fetch
+  // Memory extension registers
+  short ib; // Instruction buffer
+  short sf; // save field
+  short intr_inhibit; // interrupt inhibit flag
+  // Time share registers
+  short uf; // User Flag
+  short ub; // User Buffer
+  short sr; // Switch Registers, 1 is switch up
+  // KE8E Extended Arithmetic Element
+  short sc; // Step Counter
+  short gt; // Greater Than flag
+  short eae_b; // EAE in mode B
+  // TODO add F D E state bits
+
+  volatile int attention; // ATTN_* bits, see cpu_run()
+  unsigned long long time; // Emulated time in nanoseconds
+  unsigned long long deadline; // Time of the next event
+  cpu_engine_t engine;
+  char stop_checks; // cpu_run() tests breakpoints[]
+  char watching; // Any watch set, see cpu_run_watched()
+  char trace_instruction;
+  short internal_stop_at;
+  short speed; // Percent of PDP-8/E speed, 0 runs as fast as possible
+  char warp; // Don't pace the time skipped in idle loops
+  unsigned long long pace_time; // time and host clock when pacing
+  unsigned long long pace_host; // started, see machine_pace()
+  struct cpu_cache *cache; // Engine private, predecoded and translated code
+
+  event_queue_t events;
+  tty_t tty;
+  clk_t clk;
+  prof_t prof;
+  trace_t trace;
+  trace_filter_t trace_filter;
+  unsigned int trace_skip[MEMSIZE / 32]; // Addresses outside the ranges
+
+  short mem[MEMSIZE];
+  short breakpoints[MEMSIZE];
+  bp_cond_t bp_conds[BP_CONDS]; // See machine_set_bp_cond()
+  char watches[MEMSIZE]; // WATCH_* bits
+  unsigned int watch_pages[MEMSIZE / 4096]; // See WATCHED()
+  short watch_addr; // Address of the last watch hit
+  unsigned int coverage[MEMSIZE / 32]; // See COVERAGE_SET()
+  unsigned int history_pos; // See HISTORY_ADD()
+  history_t history[HISTORY_SIZE];
+#ifdef CPU_STATS
+  unsigned long long stats[STAT_COUNT];
+#endif
+} CACHE_ALIGNED;
+
+#endif // _PDP8_H_
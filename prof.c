@@ -0,0 +1,387 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prof.h"
+#include "cpu.h"
+#include "pdp8.h"
+
+#define PROF_INITIAL_SIZE 1024
+
+static unsigned long hash(const short *pc, int len)
+{
+  unsigned long h = 2166136261UL; // FNV-1a
+
+  for( int i = 0; i < len; i++ ){
+    h = (h ^ (unsigned short)pc[i]) * 16777619UL;
+  }
+  return h;
+}
+
+static void insert(prof_t *p, const short *pc, int depth,
+                   unsigned long long count)
+{
+  long i = hash(pc, depth + 1) & (p->size - 1);
+
+  while( p->samples[i].count ){
+    if( p->samples[i].depth == depth &&
+        ! memcmp(p->samples[i].pc, pc, (depth + 1) * sizeof(short)) ){
+      p->samples[i].count += count;
+      return;
+    }
+    i = (i + 1) & (p->size - 1);
+  }
+  p->samples[i].count = count;
+  p->samples[i].depth = depth;
+  memcpy(p->samples[i].pc, pc, (depth + 1) * sizeof(short));
+  p->used++;
+}
+
+// Double the table when it is three quarters full. Stops sampling if
+// out of memory.
+static void grow(pdp8_machine_t *m)
+{
+  prof_t *p = &m->prof;
+  prof_sample_t *old = p->samples;
+  long size = p->size;
+
+  p->samples = calloc(size * 2, sizeof(prof_sample_t));
+  if( p->samples == NULL ){
+    printf("?? out of memory, sampling stopped ??\n");
+    p->samples = old;
+    p->period = 0;
+    event_cancel(m, prof_tick);
+    return;
+  }
+  p->size = size * 2;
+  p->used = 0;
+  for( long i = 0; i < size; i++ ){
+    if( old[i].count ){
+      insert(p, old[i].pc, old[i].depth, old[i].count);
+    }
+  }
+  free(old);
+}
+
+static void sample(pdp8_machine_t *m)
+{
+  prof_t *p = &m->prof;
+  short pc[PROF_DEPTH + 1];
+
+  for( int i = 0; i < p->depth; i++ ){
+    pc[i] = p->stack[i].entry;
+  }
+  pc[p->depth] = m->pc;
+  insert(p, pc, p->depth, 1);
+  if( p->used * 4 >= p->size * 3 ){
+    grow(m);
+  }
+}
+
+static void insert_edge(prof_t *p, short caller, short callee,
+                        unsigned long long calls)
+{
+  long i = hash((short[]){ caller, callee }, 2) & (p->edges_size - 1);
+
+  while( p->edges[i].calls ){
+    if( p->edges[i].caller == caller && p->edges[i].callee == callee ){
+      p->edges[i].calls += calls;
+      return;
+    }
+    i = (i + 1) & (p->edges_size - 1);
+  }
+  p->edges[i].calls = calls;
+  p->edges[i].caller = caller;
+  p->edges[i].callee = callee;
+  p->edges_used++;
+}
+
+// Count a call, the edge table grows like the sample table.
+static void count_call(prof_t *p, short caller, short callee)
+{
+  p->routines[callee].calls++;
+  insert_edge(p, caller, callee, 1);
+  if( p->edges_used * 4 >= p->edges_size * 3 ){
+    prof_edge_t *old = p->edges;
+    long size = p->edges_size;
+
+    p->edges = calloc(size * 2, sizeof(prof_edge_t));
+    if( p->edges == NULL ){
+      p->edges = old; // Keep counting in a fuller table
+      return;
+    }
+    p->edges_size = size * 2;
+    p->edges_used = 0;
+    for( long i = 0; i < size; i++ ){
+      if( old[i].calls ){
+        insert_edge(p, old[i].caller, old[i].callee, old[i].calls);
+      }
+    }
+    free(old);
+  }
+}
+
+// Return from the call in frame i and all calls inside it, adding
+// their instructions and time to their routines and to the callers.
+static void leave(pdp8_machine_t *m, int i)
+{
+  prof_t *p = &m->prof;
+
+  while( p->depth > i ){
+    prof_frame_t *f = &p->stack[--p->depth];
+    unsigned long long instructions = p->instructions - f->instructions;
+    unsigned long long time = m->time - f->time;
+
+    if( p->routines ){
+      prof_routine_t *r = &p->routines[f->entry];
+      r->instructions += instructions;
+      r->self_instructions += instructions - f->child_instructions;
+      r->time += time;
+      r->self_time += time - f->child_time;
+    }
+    if( p->depth > 0 ){
+      p->stack[p->depth - 1].child_instructions += instructions;
+      p->stack[p->depth - 1].child_time += time;
+    }
+  }
+}
+
+
+// Sample every period instructions, or every period microseconds of
+// emulated time with PROF_PER_TIME, and with PROF_CALLS count calls
+// per routine. Counts from an earlier start are thrown away.
+void prof_start(pdp8_machine_t *m, long period, char flags)
+{
+  prof_t *p = &m->prof;
+
+  prof_stop(m);
+  if( period > 0 ){
+    p->samples = calloc(PROF_INITIAL_SIZE, sizeof(prof_sample_t));
+    p->size = PROF_INITIAL_SIZE;
+  }
+  if( flags & PROF_CALLS ){
+    p->routines = calloc(MEMSIZE, sizeof(prof_routine_t));
+    p->edges = calloc(PROF_INITIAL_SIZE, sizeof(prof_edge_t));
+    p->edges_size = PROF_INITIAL_SIZE;
+  }
+  if( (period > 0 && p->samples == NULL) ||
+      ((flags & PROF_CALLS) && (p->routines == NULL || p->edges == NULL)) ){
+    printf("?? out of memory, profiling not started ??\n");
+    prof_stop(m);
+    return;
+  }
+  p->period = period;
+  p->left = period;
+  p->flags = flags;
+  p->on = 1;
+  if( period > 0 && (flags & PROF_PER_TIME) ){
+    event_post(m, period * 1000ULL, prof_tick);
+  }
+}
+
+
+void prof_stop(pdp8_machine_t *m)
+{
+  event_cancel(m, prof_tick);
+  free(m->prof.samples);
+  free(m->prof.routines);
+  free(m->prof.edges);
+  memset(&m->prof, 0, sizeof(prof_t));
+}
+
+
+// Run in place of cpu_run() while profiling, up to the next event or
+// the next sample.
+void prof_run(pdp8_machine_t *m)
+{
+  prof_t *p = &m->prof;
+
+  if( p->period == 0 || (p->flags & PROF_PER_TIME) ){
+    cpu_run_profiled(m, LONG_MAX);
+    return;
+  }
+  p->left -= cpu_run_profiled(m, p->left);
+  if( p->left <= 0 ){
+    sample(m);
+    p->left = p->period;
+  }
+}
+
+
+// The sample event when the period is emulated time.
+char prof_tick(pdp8_machine_t *m)
+{
+  sample(m);
+  event_post(m, m->prof.period * 1000ULL, prof_tick);
+  return 0;
+}
+
+
+// A JMS to entry, or an interrupt with entry 0. PDP-8 subroutines
+// keep their return address in the entry word, so a routine that is
+// already on the stack has been left without returning and its frame
+// and everything inside it is dropped.
+void prof_call(pdp8_machine_t *m, short entry)
+{
+  prof_t *p = &m->prof;
+  prof_frame_t *f;
+
+  if( p->routines ){
+    count_call(p, p->depth ? p->stack[p->depth - 1].entry : -1, entry);
+  }
+  for( int i = 0; i < p->depth; i++ ){
+    if( p->stack[i].entry == entry ){
+      leave(m, i);
+      break;
+    }
+  }
+  if( p->depth == PROF_DEPTH ){
+    memmove(p->stack, p->stack + 1, (PROF_DEPTH - 1) * sizeof(prof_frame_t));
+    p->depth--;
+  }
+  f = &p->stack[p->depth++];
+  f->entry = entry;
+  f->instructions = p->instructions;
+  f->time = m->time;
+  f->child_instructions = 0;
+  f->child_time = 0;
+}
+
+
+// A JMP I through entry. Returns from the innermost call with that
+// entry, and from any calls it made. Indirect jumps through other
+// words are not returns.
+void prof_return(pdp8_machine_t *m, short entry)
+{
+  prof_t *p = &m->prof;
+
+  for( int i = p->depth - 1; i >= 0; i-- ){
+    if( p->stack[i].entry == entry ){
+      leave(m, i);
+      return;
+    }
+  }
+}
+
+
+static int compare(const void *a, const void *b)
+{
+  const prof_sample_t *x = *(prof_sample_t * const *)a;
+  const prof_sample_t *y = *(prof_sample_t * const *)b;
+
+  for( int i = 0; i <= x->depth && i <= y->depth; i++ ){
+    if( x->pc[i] != y->pc[i] ){
+      return x->pc[i] - y->pc[i];
+    }
+  }
+  return x->depth - y->depth;
+}
+
+// Write the samples in the folded stack format of flamegraph tools,
+// one line per distinct stack: the JMS entry addresses from the
+// outermost call in, then the sampled PC, and the number of samples.
+// Returns 0 if the file could not be written.
+int prof_write(pdp8_machine_t *m, const char *filename)
+{
+  prof_t *p = &m->prof;
+  prof_sample_t **sorted = calloc(p->used + 1, sizeof(prof_sample_t *));
+  FILE *fh;
+  long n = 0;
+
+  if( sorted == NULL || p->samples == NULL ){
+    free(sorted);
+    return 0;
+  }
+  fh = fopen(filename, "w");
+  if( fh == NULL ){
+    perror("Unable to open profile file");
+    free(sorted);
+    return 0;
+  }
+  for( long i = 0; i < p->size; i++ ){
+    if( p->samples[i].count ){
+      sorted[n++] = &p->samples[i];
+    }
+  }
+  qsort(sorted, n, sizeof(prof_sample_t *), compare);
+  for( long i = 0; i < n; i++ ){
+    for( int j = 0; j <= sorted[i]->depth; j++ ){
+      fprintf(fh, j ? ";%.5o" : "%.5o", sorted[i]->pc[j]);
+    }
+    fprintf(fh, " %llu\n", sorted[i]->count);
+  }
+  free(sorted);
+  return fclose(fh) == 0;
+}
+
+
+static int compare_edges(const void *a, const void *b)
+{
+  const prof_edge_t *x = a;
+  const prof_edge_t *y = b;
+
+  if( x->caller != y->caller ){
+    return x->caller - y->caller;
+  }
+  return x->callee - y->callee;
+}
+
+// Write the call graph, one line per routine and one per caller and
+// callee pair, with a # comment naming the columns. Calls that have
+// not returned are counted up to now. Returns 0 if the file could not
+// be written.
+int prof_write_calls(pdp8_machine_t *m, const char *filename)
+{
+  prof_t *p = &m->prof;
+  prof_edge_t *sorted;
+  FILE *fh;
+  long n = 0;
+
+  if( p->routines == NULL ){
+    return 0;
+  }
+  sorted = calloc(p->edges_used + 1, sizeof(prof_edge_t));
+  if( sorted == NULL ){
+    return 0;
+  }
+  fh = fopen(filename, "w");
+  if( fh == NULL ){
+    perror("Unable to open call graph file");
+    free(sorted);
+    return 0;
+  }
+  leave(m, 0);
+  fprintf(fh, "# routine entry calls instructions self_instructions ns self_ns\n");
+  for( int i = 0; i < MEMSIZE; i++ ){
+    prof_routine_t *r = &p->routines[i];
+    if( r->calls ){
+      fprintf(fh, "routine %.5o %llu %llu %llu %llu %llu\n", i, r->calls,
+              r->instructions, r->self_instructions, r->time, r->self_time);
+    }
+  }
+  for( long i = 0; i < p->edges_size; i++ ){
+    if( p->edges[i].calls ){
+      sorted[n++] = p->edges[i];
+    }
+  }
+  qsort(sorted, n, sizeof(prof_edge_t), compare_edges);
+  fprintf(fh, "# call caller callee calls\n");
+  for( long i = 0; i < n; i++ ){
+    if( sorted[i].caller < 0 ){
+      fprintf(fh, "call - %.5o %llu\n", sorted[i].callee, sorted[i].calls);
+    } else {
+      fprintf(fh, "call %.5o %.5o %llu\n", sorted[i].caller,
+              sorted[i].callee, sorted[i].calls);
+    }
+  }
+  free(sorted);
+  return fclose(fh) == 0;
+}
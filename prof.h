@@ -0,0 +1,87 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _PROF_H_
+#define _PROF_H_
+
+#include "cpu.h"
+
+// Calls deeper than this drop their outermost frames.
+#define PROF_DEPTH 32
+
+// prof_start() flags
+#define PROF_PER_TIME 01 // The sample period is in microseconds
+#define PROF_CALLS 02 // Count calls, instructions and time per routine
+
+// One distinct stack in the sample table, the JMS entries from the
+// outermost call inwards followed by the sampled PC.
+typedef struct prof_sample {
+  unsigned long long count;
+  short depth;
+  short pc[PROF_DEPTH + 1];
+} prof_sample_t;
+
+// A call that has not returned, with the instruction count and time
+// when it was made and what its own calls have used so far.
+typedef struct prof_frame {
+  short entry; // JMS target, where the return address is stored
+  unsigned long long instructions;
+  unsigned long long time;
+  unsigned long long child_instructions;
+  unsigned long long child_time;
+} prof_frame_t;
+
+// Totals per routine, indexed by entry address. Inclusive counts
+// include the routines it calls, exclusive counts do not.
+typedef struct prof_routine {
+  unsigned long long calls;
+  unsigned long long instructions;
+  unsigned long long self_instructions;
+  unsigned long long time;
+  unsigned long long self_time;
+} prof_routine_t;
+
+// Caller/callee pair in the edge table. caller is -1 for calls made
+// outside any routine.
+typedef struct prof_edge {
+  unsigned long long calls;
+  short caller;
+  short callee;
+} prof_edge_t;
+
+// Guest profiler, part of pdp8_machine_t. While it is on,
+// machine_run() runs the CPU with cpu_run_profiled(), which reports
+// every JMS, interrupt and indirect JMP to keep a shadow stack of the
+// calls that have not returned.
+typedef struct prof {
+  char on;
+  char flags; // PROF_*
+  long period; // Sample period, 0 if not sampling
+  long left; // Instructions to the next sample
+  unsigned long long instructions; // Executed while on
+  short depth;
+  prof_frame_t stack[PROF_DEPTH];
+  long size; // Slots in samples, a power of two
+  long used;
+  prof_sample_t *samples; // Open addressing hash table
+  prof_routine_t *routines; // MEMSIZE entries with PROF_CALLS
+  long edges_size; // Slots in edges, a power of two
+  long edges_used;
+  prof_edge_t *edges; // Open addressing hash table
+} prof_t;
+
+void prof_start(pdp8_machine_t *m, long period, char flags);
+void prof_stop(pdp8_machine_t *m);
+void prof_run(pdp8_machine_t *m);
+char prof_tick(pdp8_machine_t *m);
+void prof_call(pdp8_machine_t *m, short entry);
+void prof_return(pdp8_machine_t *m, short entry);
+int prof_write(pdp8_machine_t *m, const char *filename);
+int prof_write_calls(pdp8_machine_t *m, const char *filename);
+
+#endif // _PROF_H_
@@ -138,7 +138,7 @@ static char read_byte(int fd)
 // is up to the sender to retry or go to console mode.
 int recv_cmd(int fd, unsigned char **out_buf)
 {
-  static unsigned char buf[128];
+  static unsigned char buf[FRAME_MAX];
 
   int i = 0;
   unsigned char byte;
@@ -202,7 +202,11 @@ int recv_cmd(int fd, unsigned char **out_buf)
     }
 
     if( state == FRAME ) {
-      buf[i++] = byte;
+      if( i == FRAME_MAX ){
+        state = WAIT; // Too long, wait for a new frame.
+      } else {
+        buf[i++] = byte;
+      }
     }
     
   } while(1);
@@ -9,6 +9,9 @@
 #ifndef _SERIAL_COM_H_
 #define _SERIAL_COM_H_
 
+// Largest frame content, the 'E','H' history dump is the longest.
+#define FRAME_MAX 4160
+
 void send_cmd(int fd, unsigned char *cmd, int len);
 int recv_cmd(int fd, unsigned char **out_buf);
 void send_console_break(int fd);
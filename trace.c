@@ -0,0 +1,353 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "trace.h"
+#include "cpu.h"
+#include "pdp8.h"
+
+// One field of a record. Writing, value is stored if it is not the
+// predicted one. Reading, the stored value or the prediction is
+// returned.
+static short field(unsigned char **p, unsigned char *flags,
+                   unsigned char flag, short value, short predicted,
+                   char decode)
+{
+  if( decode ){
+    if( *flags & flag ){
+      value = ((*p)[0] | (*p)[1] << 8) & 077777;
+      *p += 2;
+      return value;
+    }
+    return predicted;
+  }
+  if( value != predicted ){
+    *flags |= flag;
+    (*p)[0] = value & 0xFF;
+    (*p)[1] = value >> 8;
+    *p += 2;
+  }
+  return value;
+}
+
+// Write r at buf, or with decode read it from buf. Both ways the
+// coder learns the same things from the record, the words at PC and
+// the operands, what ISZ, DCA, JMS and interrupts store and where
+// jumps go, so the next record is predicted alike. Returns the length
+// of the record.
+static int code(trace_coder_t *c, trace_record_t *r, unsigned char *buf,
+                char decode)
+{
+  unsigned char flags = decode ? buf[0] : (r->interrupt ? TRACE_INTERRUPT : 0);
+  unsigned char *p = buf + 1;
+
+  r->interrupt = (flags & TRACE_INTERRUPT) != 0;
+  r->pc = field(&p, &flags, TRACE_PC, r->pc, c->next_pc, decode);
+  if( r->interrupt ){
+    r->word = JMS;
+  } else {
+    r->word = field(&p, &flags, TRACE_WORD, r->word, c->mem[r->pc], decode);
+    c->mem[r->pc] = r->word;
+  }
+  c->ac = r->ac = field(&p, &flags, TRACE_AC, r->ac, c->ac, decode);
+  c->mq = r->mq = field(&p, &flags, TRACE_MQ, r->mq, c->mq, decode);
+  c->state = r->state = field(&p, &flags, TRACE_STATE, r->state, c->state,
+                              decode);
+  c->next_pc = (r->pc & FIELD_MASK) | INC_12BIT(r->pc);
+
+  if( r->interrupt ){
+    c->mem[0] = r->pc & B12_MASK;
+    c->next_pc = 1;
+  } else if( (r->word & IF_MASK) <= JMP ){
+    short direct = direct_addr(r->pc, r->word);
+
+    if( r->word & I_MASK ){
+      short ptr = c->mem[direct];
+      short base = (r->word & IF_MASK) < JMS ?
+        (r->state & 07) << 12 : r->pc & FIELD_MASK;
+
+      if( (direct & (PAGE_MASK|WORD_MASK)) >= 010 &&
+          (direct & (PAGE_MASK|WORD_MASK)) <= 017 ){
+        ptr = INC_12BIT(ptr); // Autoindex
+      }
+      r->addr = field(&p, &flags, TRACE_ADDR, r->addr, base | ptr, decode);
+      c->mem[direct] = r->addr & B12_MASK;
+    } else {
+      r->addr = direct;
+    }
+
+    switch( r->word & IF_MASK ){
+    case ISZ:
+    case DCA:
+    case AND:
+    case TAD:
+      r->data = field(&p, &flags, TRACE_DATA, r->data, c->mem[r->addr],
+                      decode);
+      c->mem[r->addr] = r->data;
+      if( (r->word & IF_MASK) == ISZ ){
+        c->mem[r->addr] = INC_12BIT(r->data);
+      } else if( (r->word & IF_MASK) == DCA ){
+        c->mem[r->addr] = r->ac & AC_MASK;
+      }
+      break;
+    case JMS:
+      c->mem[r->addr] = INC_12BIT(r->pc);
+      c->next_pc = (r->addr & FIELD_MASK) | INC_12BIT(r->addr);
+      break;
+    case JMP:
+      c->next_pc = r->addr;
+      break;
+    }
+  }
+
+  if( ! decode ){
+    buf[0] = flags;
+  }
+  return p - buf;
+}
+
+
+// Write what is buffered. Returns 0 if the write failed.
+static int flush(trace_t *t)
+{
+  long len = t->len;
+
+  t->len = 0;
+  if( write(t->fd, t->buf, len) != len ){
+    perror("Unable to write trace file");
+    return 0;
+  }
+  return 1;
+}
+
+
+// The registers in the state field of a record, DF in the three least
+// significant bits, then the EAE mode, GT, ION, whether any interrupt
+// is requested and the 7 bits of SF.
+short trace_state(short df, short eae_b, short gt, short ion, short intr,
+                  short sf)
+{
+  return df | eae_b << 3 | gt << 4 | ion << 5 | (intr != 0) << 6 | sf << 7;
+}
+
+
+// Record every instruction to filename until trace_stop(). Returns 0
+// if the file could not be created.
+int trace_start(pdp8_machine_t *m, const char *filename)
+{
+  trace_t *t = &m->trace;
+
+  trace_stop(m);
+  t->buf = malloc(TRACE_BUFFER);
+  t->coder = calloc(1, sizeof(trace_coder_t));
+  if( t->buf == NULL || t->coder == NULL ){
+    printf("?? out of memory, trace not started ??\n");
+    trace_stop(m);
+    return 0;
+  }
+  t->fd = open(filename, O_WRONLY|O_CREAT|O_TRUNC, 0666);
+  if( t->fd == -1 ){
+    perror("Unable to open trace file");
+    trace_stop(m);
+    return 0;
+  }
+  memcpy(t->buf, TRACE_MAGIC, TRACE_MAGIC_LEN);
+  t->len = TRACE_MAGIC_LEN;
+  t->coder->next_pc = -1; // The first record has the PC
+  t->on = 1;
+  return 1;
+}
+
+
+// Write what is buffered and close the file.
+void trace_stop(pdp8_machine_t *m)
+{
+  trace_t *t = &m->trace;
+
+  if( t->fd >= 0 ){
+    char ok = flush(t);
+    if( close(t->fd) != 0 && ok ){
+      perror("Unable to write trace file");
+    }
+  }
+  free(t->buf);
+  free(t->coder);
+  memset(t, 0, sizeof(trace_t));
+  t->fd = -1;
+}
+
+
+// Run in place of cpu_run() while tracing, up to the next event.
+void trace_run(pdp8_machine_t *m)
+{
+  cpu_run_traced(m, LONG_MAX);
+}
+
+
+// Record the instruction at PC, or the interrupt, about to execute.
+// The operand is looked up the way fetch() does, without incrementing
+// an autoindex pointer.
+void trace_record(pdp8_machine_t *m)
+{
+  trace_t *t = &m->trace;
+  trace_record_t r;
+
+  r.interrupt = m->ion && m->intr && ! m->intr_inhibit;
+  r.pc = m->pc;
+  r.word = m->mem[m->pc];
+  r.ac = m->ac;
+  r.mq = m->mq;
+  r.state = trace_state(m->df, m->eae_b, m->gt, m->ion, m->intr, m->sf);
+  if( ! r.interrupt && (r.word & IF_MASK) <= JMP ){
+    r.addr = direct_addr(r.pc, r.word);
+    if( r.word & I_MASK ){
+      short ptr = m->mem[r.addr];
+
+      if( (r.addr & (PAGE_MASK|WORD_MASK)) >= 010 &&
+          (r.addr & (PAGE_MASK|WORD_MASK)) <= 017 ){
+        ptr = INC_12BIT(ptr);
+      }
+      r.addr = ((r.word & IF_MASK) < JMS ? m->df_base : m->if_base) | ptr;
+    }
+    r.data = m->mem[r.addr];
+  }
+
+  t->len += code(t->coder, &r, t->buf + t->len, 0);
+  t->records++;
+  if( t->len > TRACE_BUFFER - TRACE_RECORD_MAX && ! flush(t) ){
+    trace_stop(m);
+  }
+}
+
+
+// Replace the filter of the printed trace and trace files. The PC
+// ranges are kept as a bitmap of the addresses outside them.
+void trace_set_filter(pdp8_machine_t *m, const trace_filter_t *filter)
+{
+  trace_filter_t *f = &m->trace_filter;
+
+  *f = *filter;
+  if( f->ranges > TRACE_RANGES ){
+    f->ranges = TRACE_RANGES;
+  }
+  memset(m->trace_skip, f->ranges ? 0xFF : 0, sizeof(m->trace_skip));
+  for( int i = 0; i < f->ranges; i++ ){
+    for( int pc = f->first[i]; pc <= f->last[i] && pc < MEMSIZE; pc++ ){
+      m->trace_skip[pc >> 5] &= ~(1U << (pc & 31));
+    }
+  }
+}
+
+
+// Whether the instruction, or interrupt, about to execute passes the
+// filter. The first one at the after address ends the wait.
+char trace_filter_pass(pdp8_machine_t *m)
+{
+  trace_filter_t *f = &m->trace_filter;
+  short word = m->ion && m->intr && ! m->intr_inhibit ? JMS : m->mem[m->pc];
+
+  if( f->wait ){
+    if( m->pc != f->after ){
+      return 0;
+    }
+    f->wait = 0;
+  }
+  if( (m->trace_skip[m->pc >> 5] >> (m->pc & 31)) & 1 ){
+    return 0;
+  }
+  if( f->classes ){
+    char class = (word & IF_MASK) < IOT ? TRACE_MRI :
+      (word & IF_MASK) == IOT ? TRACE_IOT : TRACE_OPR;
+    if( ! (f->classes & class) ){
+      return 0;
+    }
+  }
+  if( f->devices && (word & IF_MASK) == IOT &&
+      ! ((f->devices >> ((word & DEV_MASK) >> 3)) & 1) ){
+    return 0;
+  }
+  return 1;
+}
+
+
+// Open a trace file written by trace_start() for trace_read(). Returns
+// 0 if it can not be read.
+int trace_open(trace_t *t, const char *filename)
+{
+  char magic[TRACE_MAGIC_LEN];
+
+  memset(t, 0, sizeof(trace_t));
+  t->fd = open(filename, O_RDONLY);
+  if( t->fd == -1 ){
+    perror("Unable to open trace file");
+    return 0;
+  }
+  if( read(t->fd, magic, TRACE_MAGIC_LEN) != TRACE_MAGIC_LEN ||
+      memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LEN) ){
+    printf("?? %s is not a trace file ??\n", filename);
+    trace_close(t);
+    return 0;
+  }
+  t->buf = malloc(TRACE_BUFFER);
+  t->coder = calloc(1, sizeof(trace_coder_t));
+  if( t->buf == NULL || t->coder == NULL ){
+    printf("?? out of memory ??\n");
+    trace_close(t);
+    return 0;
+  }
+  t->coder->next_pc = -1;
+  return 1;
+}
+
+
+// Read the next record. Returns 1, 0 at the end of the file and -1 if
+// the file ends in the middle of a record.
+int trace_read(trace_t *t, trace_record_t *r)
+{
+  int len = 1;
+
+  if( t->len - t->pos < TRACE_RECORD_MAX ){
+    long n;
+
+    memmove(t->buf, t->buf + t->pos, t->len - t->pos);
+    t->len -= t->pos;
+    t->pos = 0;
+    while( (n = read(t->fd, t->buf + t->len, TRACE_BUFFER - t->len)) > 0 ){
+      t->len += n;
+    }
+  }
+  if( t->pos == t->len ){
+    return 0;
+  }
+  for( int flag = TRACE_PC; flag < TRACE_INTERRUPT; flag <<= 1 ){
+    len += t->buf[t->pos] & flag ? 2 : 0;
+  }
+  if( t->pos + len > t->len ){
+    return -1;
+  }
+  t->pos += code(t->coder, r, t->buf + t->pos, 1);
+  t->records++;
+  return 1;
+}
+
+
+void trace_close(trace_t *t)
+{
+  if( t->fd >= 0 ){
+    close(t->fd);
+  }
+  free(t->buf);
+  free(t->coder);
+  memset(t, 0, sizeof(trace_t));
+  t->fd = -1;
+}
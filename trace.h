@@ -0,0 +1,101 @@
+/*
+  Copyright (c) 2019 Pontus Pihlgren <pontus.pihlgren@gmail.com>
+  All rights reserved.
+
+  This source code is licensed under the BSD-style license found in the
+  LICENSE file in the root directory of this source tree.
+*/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include "cpu.h"
+
+// First bytes of a trace file
+#define TRACE_MAGIC "PDP8TRC1"
+#define TRACE_MAGIC_LEN 8
+
+// Bytes buffered before they are written to the file
+#define TRACE_BUFFER (1 << 20)
+
+// Each record is a flags byte followed by the fields that differ from
+// what the previous records predict, 16 bits each, least significant
+// byte first, in the order of the flags.
+#define TRACE_PC 0001 // Not the next word, or the JMP or JMS target
+#define TRACE_WORD 0002 // Not the word last executed at PC
+#define TRACE_AC 0004 // AC and link changed
+#define TRACE_MQ 0010 // MQ changed
+#define TRACE_STATE 0020 // DF, EAE mode, GT, ION, INTR or SF changed
+#define TRACE_ADDR 0040 // Indirect address not the pointer last seen
+#define TRACE_DATA 0100 // Operand not the value last seen
+#define TRACE_INTERRUPT 0200 // Interrupt, JMS to 0 instead of the word at PC
+#define TRACE_RECORD_MAX (1 + 7 * 2)
+
+// trace_filter_t classes
+#define TRACE_MRI 01
+#define TRACE_IOT 02
+#define TRACE_OPR 04
+
+#define TRACE_RANGES 8
+
+// Which instructions the printed trace and trace files show. Zero
+// passes everything, so a new machine traces all instructions.
+typedef struct trace_filter {
+  char classes; // TRACE_MRI, TRACE_IOT and TRACE_OPR, 0 for all
+  char wait; // Nothing passes until the instruction at after
+  short after;
+  unsigned long long devices; // Bit per IOT device code, 0 for all
+  short ranges; // PC ranges with the field, 0 for all addresses
+  short first[TRACE_RANGES];
+  short last[TRACE_RANGES];
+} trace_filter_t;
+
+// The CPU state before one instruction, or before an interrupt.
+// state packs the registers the disassembler shows, see trace_state().
+typedef struct trace_record {
+  char interrupt;
+  short pc;
+  short word;
+  short ac; // With the link
+  short mq;
+  short state;
+  short addr; // Effective address of a memory reference instruction
+  short data; // Operand of AND, TAD, ISZ and DCA before it executes
+} trace_record_t;
+
+// Both the writer and the reader keep what the records so far tell
+// about memory and registers, so only the differences are stored.
+typedef struct trace_coder {
+  short mem[MEMSIZE];
+  short next_pc;
+  short ac;
+  short mq;
+  short state;
+} trace_coder_t;
+
+// Binary instruction trace, part of pdp8_machine_t. While it is on,
+// machine_run() runs the CPU with cpu_run_traced(), which records
+// every instruction before it executes.
+typedef struct trace {
+  char on;
+  int fd;
+  unsigned long long records;
+  long len; // Bytes in buf
+  long pos; // Next byte to decode in buf
+  unsigned char *buf; // TRACE_BUFFER bytes
+  trace_coder_t *coder;
+} trace_t;
+
+int trace_start(pdp8_machine_t *m, const char *filename);
+void trace_stop(pdp8_machine_t *m);
+void trace_run(pdp8_machine_t *m);
+void trace_record(pdp8_machine_t *m);
+void trace_set_filter(pdp8_machine_t *m, const trace_filter_t *filter);
+char trace_filter_pass(pdp8_machine_t *m);
+short trace_state(short df, short eae_b, short gt, short ion, short intr,
+                  short sf);
+int trace_open(trace_t *t, const char *filename);
+int trace_read(trace_t *t, trace_record_t *r);
+void trace_close(trace_t *t);
+
+#endif // _TRACE_H_
@@ -8,42 +8,55 @@
 
 #include "tty.h"
 #include "cpu.h"
+#include "pdp8.h"
 #include "machine.h"
 
-// TTY registers
-short tty_kb_buf = 0;
-short tty_kb_flag = 0;
-short tty_tp_buf = 0;
-short tty_tp_flag = 0;
-short tty_dcr = 0; // device control register
-
-// TTY internals
-char output_pending = 0;
+// The teleprinter has printed the character in tp_buf.
+static char tty_output_done(pdp8_machine_t *m)
+{
+  if( m->tty.connected ){
+    write_tty_byte(m->tty.tp_buf);
+  }
+  m->tty.tp_flag = 1;
+  if( m->tty.dcr & TTY_IE_MASK ){
+    cpu_raise_interrupt(m, TTYO_INTR_FLAG);
+  }
+  return 0;
+}
 
-void tty_initiate_output()
+void tty_initiate_output(pdp8_machine_t *m)
 {
-  output_pending = 1;
+  event_post(m, TTY_PRINT_TIME, tty_output_done);
 }
 
-void tty_reset(){
-  tty_kb_buf = 0;
-  tty_kb_flag = 0;
-  tty_tp_buf = 0;
-  tty_tp_flag = 0;
-  tty_dcr = TTY_IE_MASK;
+void tty_reset(pdp8_machine_t *m){
+  m->tty.kb_buf = 0;
+  m->tty.kb_flag = 0;
+  m->tty.tp_buf = 0;
+  m->tty.tp_flag = 0;
+  m->tty.dcr = TTY_IE_MASK;
 }
 
-char tty_process(){
-  // TTY and console handling:
+// Connect the TTY to the host console and start polling the keyboard.
+void tty_connect(pdp8_machine_t *m)
+{
+  m->tty.connected = 1;
+  event_post(m, 0, tty_process);
+}
+
+// Keyboard poll, runs every TTY_POLL_TIME once connected.
+char tty_process(pdp8_machine_t *m){
+  event_post(m, TTY_POLL_TIME, tty_process);
+
   // If keyboard flag is not set, try to read one char.
-  if( !tty_kb_flag ) {
+  if( !m->tty.kb_flag ) {
     char input, res;
     res = read_tty_byte(&input);
     if( res == 1 ) {
-      tty_kb_buf = input;
-      tty_kb_flag = 1;
-      if( tty_dcr & TTY_IE_MASK ){
-        cpu_raise_interrupt(TTYI_INTR_FLAG);
+      m->tty.kb_buf = input;
+      m->tty.kb_flag = 1;
+      if( m->tty.dcr & TTY_IE_MASK ){
+        cpu_raise_interrupt(m, TTYI_INTR_FLAG);
       }
     }
     if( res == -1 ){
@@ -51,15 +64,5 @@ char tty_process(){
     }
   }
 
-  // If output teleprinter buffer if requested.
-  if( output_pending ){
-    output_pending = 0;
-    write_tty_byte(tty_tp_buf);
-    tty_tp_flag = 1;
-    if( tty_dcr & TTY_IE_MASK ){
-      cpu_raise_interrupt(TTYO_INTR_FLAG);
-    }
-  }
-
   return 0;
 }
@@ -9,18 +9,30 @@
 #ifndef _TTY_H_
 #define _TTY_H_
 
-// TTY registers
-extern short tty_kb_buf;
-extern short tty_kb_flag;
-extern short tty_tp_buf;
-extern short tty_tp_flag;
-extern short tty_dcr; // device control register
+#include "cpu.h"
+
+// TTY registers, part of pdp8_machine_t
+typedef struct tty {
+  short kb_buf;
+  short kb_flag;
+  short tp_buf;
+  short tp_flag;
+  short dcr; // device control register
+  // TTY internals
+  char connected; // Keyboard and printer are the host console
+} tty_t;
+
+// Emulated nanoseconds between keyboard polls, and to print one
+// character on a 110 baud ASR 33
+#define TTY_POLL_TIME 1000000
+#define TTY_PRINT_TIME 100000000
 
 #define TTY_SE_MASK 02
 #define TTY_IE_MASK 01
 
-void tty_reset(void);
-char tty_process(void);
-void tty_initiate_output();
+void tty_reset(pdp8_machine_t *m);
+void tty_connect(pdp8_machine_t *m);
+char tty_process(pdp8_machine_t *m);
+void tty_initiate_output(pdp8_machine_t *m);
 
 #endif // _TTY_H_